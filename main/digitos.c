@@ -18,46 +18,94 @@ SPDX-License-Identifier: MIT
 *********************************************************************************************************************/
 
 /** @file digitos.c
- ** @brief Definiciones de la biblioteca para dibujar paneles con digitos de 7 segmentos en una pantalla TFT
+ ** @brief Definiciones de la biblioteca para dibujar paneles con digitos de 7 y 14 segmentos en una pantalla TFT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
 #include "digitos.h"
+#include "esp_log.h"
+#include "esp_timer.h"
 #include "ili9341.h"
+#include "rgb565.h"
+#include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
-#define SEGMENTO_A 0x01 //!< Máscara para el segmento A
-#define SEGMENTO_B 0x02 //!< Máscara para el segmento B
-#define SEGMENTO_C 0x04 //!< Máscara para el segmento C
-#define SEGMENTO_D 0x08 //!< Máscara para el segmento D
-#define SEGMENTO_E 0x10 //!< Máscara para el segmento E
-#define SEGMENTO_F 0x20 //!< Máscara para el segmento F
-#define SEGMENTO_G 0x40 //!< Máscara para el segmento G
+#define SEGMENTO_A  0x0001 //!< Máscara para el segmento A
+#define SEGMENTO_B  0x0002 //!< Máscara para el segmento B
+#define SEGMENTO_C  0x0004 //!< Máscara para el segmento C
+#define SEGMENTO_D  0x0008 //!< Máscara para el segmento D
+#define SEGMENTO_E  0x0010 //!< Máscara para el segmento E
+#define SEGMENTO_F  0x0020 //!< Máscara para el segmento F
+#define SEGMENTO_G  0x0040 //!< Máscara para el segmento G, o la mitad izquierda G1 con 14 segmentos
+#define SEGMENTO_G2 0x0080 //!< Máscara para la mitad derecha G2 del segmento G con 14 segmentos
+#define SEGMENTO_H  0x0100 //!< Máscara para la diagonal superior izquierda con 14 segmentos
+#define SEGMENTO_I  0x0200 //!< Máscara para la vertical central superior con 14 segmentos
+#define SEGMENTO_J  0x0400 //!< Máscara para la diagonal superior derecha con 14 segmentos
+#define SEGMENTO_K  0x0800 //!< Máscara para la diagonal inferior izquierda con 14 segmentos
+#define SEGMENTO_L  0x1000 //!< Máscara para la vertical central inferior con 14 segmentos
+#define SEGMENTO_M  0x2000 //!< Máscara para la diagonal inferior derecha con 14 segmentos
+
+#define SIN_DIBUJAR 0x8000 //!< Máscara de un digito cuyo contenido en la pantalla se desconoce
+#define SIN_MARCAR  0xFF   //!< Estado de un separador cuyo contenido en la pantalla se desconoce
+
+#define CANTIDAD_SIMBOLOS 17 //!< Cantidad de valores de la tabla de digitos, incluyendo el digito apagado
+#define SIMBOLO_APAGADO   16 //!< Valor de la tabla de digitos que apaga todos los segmentos
+
+#define CANTIDAD_SEGMENTOS 14 //!< Cantidad máxima de segmentos de un digito
+
+#define PRIMER_CARACTER   ' ' //!< Primer caracter de la tabla de 14 segmentos
+#define ULTIMO_CARACTER   'Z' //!< Último caracter de la tabla de 14 segmentos
+#define CARACTER_APAGADO  ' ' //!< Caracter que apaga todos los segmentos de un digito de 14 segmentos
+
+#define DIAGONAL_DESCENDENTE 1 //!< Segmento diagonal que baja de izquierda a derecha
+#define DIAGONAL_ASCENDENTE  2 //!< Segmento diagonal que sube de izquierda a derecha
+
+#define MARCA_SUPERIOR 0x01 //!< Máscara del punto superior de los dos puntos
+#define MARCA_INFERIOR 0x02 //!< Máscara del punto inferior de los dos puntos
+#define MARCA_BASE     0x04 //!< Máscara del punto decimal
+#define MARCA_ALTA     0x08 //!< Máscara del apóstrofe
+
+#define SPRITE_FONDO     0x00           //!< Código de un tramo del color de fondo
+#define SPRITE_APAGADO   0x40           //!< Código de un tramo de segmentos apagados
+#define SPRITE_ENCENDIDO 0x80           //!< Código de un tramo de segmentos encendidos
+#define SPRITE_TRAMO     64             //!< Cantidad máxima de pixeles de un tramo
+#define SPRITE_FRANJA    255            //!< Cantidad máxima de filas de una franja
+#define SPRITE_ANCHO     ILI9341_HEIGHT //!< Ancho máximo de un digito pre-dibujado
+#define SPRITE_FUNDIDO   0xC0           //!< Código de los pixeles del segmento que se dibuja con un color propio
+
+#define SIN_PASO       0xFF //!< Paso de una transición cuyo contenido en la pantalla se desconoce
+#define MAXIMO_FRANJAS 8    //!< Cantidad máxima de ventanas por paso de una transición rodante
+
+#define CAMBIO_MARCA   0x10 //!< Índice del primer punto de un separador en la lista de cambios
+#define CAMBIO_SPRITE  0xFF //!< Índice de un digito pre-dibujado completo en la lista de cambios
+#define TODOS_DIGITOS  0xFF //!< Posición para descartar los cambios de todo un panel
 
 /* === Private data type declarations ============================================================================== */
 
-typedef struct punto_s {
-    uint16_t x;
-    uint16_t y;
-} * punto_t;
-
-typedef struct area_s {
-    struct punto_s desde;
-    struct punto_s hasta;
-} * area_t;
-
-typedef struct segmentos_s {
-    struct area_s a;
-    struct area_s b;
-    struct area_s c;
-    struct area_s d;
-    struct area_s e;
-    struct area_s f;
-    struct area_s g;
-} * segmentos_t;
+typedef struct transicion_s {
+    uint16_t anterior; //!< Segmentos del digito al empezar la transición
+    uint16_t destino;  //!< Segmentos del digito al terminar la transición
+    uint8_t paso;      //!< Paso al que llegó la transición
+    uint8_t dibujado;  //!< Último paso enviado a la pantalla, @ref SIN_PASO si se desconoce
+    bool activa;       //!< Indica si la transición está en curso
+} transicion_t;
+
+typedef struct franja_s {
+    uint16_t desde; //!< Primera fila de la franja
+    uint16_t hasta; //!< Última fila de la franja
+} franja_t;
+
+typedef struct cambio_s {
+    struct panel_s * panel; //!< Panel al que pertenece el cambio
+    uint8_t posicion;       //!< Digito que cambia, o digito a la izquierda del separador
+    uint8_t indice;         //!< Segmento, @ref CAMBIO_MARCA más el punto, o @ref CAMBIO_SPRITE
+    struct area_s area;     //!< Rectángulo que ocupa en la pantalla
+} cambio_t;
 
 struct panel_s {
     struct punto_s origen;
@@ -67,13 +115,72 @@ struct panel_s {
     uint16_t encendido;
     uint16_t apagado;
     uint16_t fondo;
-    struct segmentos_s segmentos;
+    uint8_t cantidad;
+    const panel_geometria_t * geometria;
     uint8_t valores[MAXIMO_DIGITOS];
+    uint16_t mascaras[MAXIMO_DIGITOS];
+    panel_estadisticas_t estadisticas;
+    bool predibujado;
+    uint16_t sprites[CANTIDAD_SIMBOLOS];
+    uint8_t * memoria;
+    uint16_t memoria_bytes;
+    uint8_t forma;
+    int8_t * tabla;
+    uint16_t tabla_bytes;
+    uint8_t separadores[MAXIMO_DIGITOS];
+    bool puntos[MAXIMO_DIGITOS];
+    uint8_t dibujados[MAXIMO_DIGITOS];
+    uint8_t animacion;
+    uint8_t pasos;
+    transicion_t transiciones[MAXIMO_DIGITOS];
 };
 
+/**
+ * La tabla de un panel con forma empieza con la ventana de cada segmento, el rectángulo que contiene todos sus tramos,
+ * y la posición en la tabla de los tramos de cada segmento. Siguen los tramos, dos bytes por cada fila del rectángulo
+ * del segmento con la cantidad de pixeles que se recorta el tramo por la izquierda y por la derecha. Los valores
+ * negativos extienden el tramo fuera del rectángulo, como ocurre con los digitos inclinados.
+ */
+typedef struct ventana_lector_s {
+    panel_t panel;       //!< Panel al que pertenece el digito
+    uint16_t mascara;    //!< Segmentos encendidos del digito
+    uint16_t fila;       //!< Próxima fila del digito a enviar
+    uint16_t hasta;      //!< Última fila del digito a enviar
+    uint16_t columna;    //!< Primera columna del digito a enviar
+    uint16_t ancho;      //!< Ancho de la ventana en pixeles
+    uint8_t indice;      //!< Segmento que se dibuja con el último color
+    uint16_t colores[4]; //!< Colores de fondo, segmento apagado, segmento encendido y del segmento dibujado
+} ventana_lector_t;
+
+/**
+ * Un digito pre-dibujado es una secuencia de franjas de filas iguales. Cada franja empieza con un byte con la cantidad
+ * de filas y sigue con los tramos de una fila, cada uno en un byte con el color en los dos bits altos y la cantidad de
+ * pixeles menos uno en los seis bits bajos.
+ */
+typedef struct sprite_lector_s {
+    const uint8_t * franja;    //!< Franja que se está enviando
+    const uint8_t * siguiente; //!< Franja que sigue a la actual
+    uint8_t filas;             //!< Filas de la franja actual que faltan enviar
+    uint16_t restantes;        //!< Filas del digito que faltan enviar
+    uint16_t ancho;            //!< Ancho del digito en pixeles
+    uint16_t colores[3];       //!< Colores de fondo, segmento apagado y segmento encendido
+} sprite_lector_t;
+
+/**
+ * En cada paso de una transición rodante la fila y de la celda muestra la fila y + desplazamiento del digito anterior
+ * seguido del nuevo, con un desplazamiento que crece con cada paso hasta el alto de la celda.
+ */
+typedef struct rodado_lector_s {
+    panel_t panel;                   //!< Panel al que pertenece el digito
+    const transicion_t * transicion; //!< Transición que se está dibujando
+    uint16_t fila;                   //!< Próxima fila del digito a enviar
+    uint16_t hasta;                  //!< Última fila del digito a enviar
+    uint16_t colores[3];             //!< Colores de fondo, segmento apagado y segmento encendido
+} rodado_lector_t;
+
 /* === Private variable declarations =============================================================================== */
 
-static const uint8_t DIGITOS[] = {
+static const uint8_t DIGITOS[CANTIDAD_SIMBOLOS] = {
     0x3F, 0x06, 0x5B, 0x4F, // 0,1,2,3
     0x66, 0x6D, 0x7D, 0x07, // 4,5,6,7
     0x7F, 0x6F, 0x77, 0x7C, // 8,9,A,B
@@ -81,17 +188,56 @@ static const uint8_t DIGITOS[] = {
     0x00,
 };
 
+//! Segmentos de los caracteres entre @ref PRIMER_CARACTER y @ref ULTIMO_CARACTER en un digito de 14 segmentos
+static const uint16_t ALFANUMERICOS[] = {
+    0x0000, 0x0006, 0x0220, 0x12CE, 0x12ED, 0x0C24, 0x235D, 0x0400, //  !"#$%&'
+    0x2400, 0x0900, 0x3FC0, 0x12C0, 0x0800, 0x00C0, 0x0000, 0x0C00, // ()*+,-./
+    0x0C3F, 0x0006, 0x00DB, 0x008F, 0x00E6, 0x2069, 0x00FD, 0x0007, // 01234567
+    0x00FF, 0x00EF, 0x1200, 0x0A00, 0x2400, 0x00C8, 0x0900, 0x1083, // 89:;<=>?
+    0x02BB, 0x00F7, 0x128F, 0x0039, 0x120F, 0x00F9, 0x0071, 0x00BD, // @ABCDEFG
+    0x00F6, 0x1209, 0x001E, 0x2470, 0x0038, 0x0536, 0x2136, 0x003F, // HIJKLMNO
+    0x00F3, 0x203F, 0x20F3, 0x00ED, 0x1201, 0x003E, 0x0C30, 0x2836, // PQRSTUVW
+    0x2D00, 0x1500, 0x0C09,                                         // XYZ
+};
+
+//! Dirección de los segmentos diagonales de un digito de 14 segmentos
+static const uint8_t DIAGONALES[CANTIDAD_SEGMENTOS] = {
+    [8] = DIAGONAL_DESCENDENTE,
+    [10] = DIAGONAL_ASCENDENTE,
+    [11] = DIAGONAL_ASCENDENTE,
+    [13] = DIAGONAL_DESCENDENTE,
+};
+
+static const char HEXADECIMALES[] = "0123456789ABCDEF";
+
+static const uint8_t SEPARADORES[] = {
+    [SEPARADOR_NINGUNO] = 0,
+    [SEPARADOR_DOS_PUNTOS] = MARCA_SUPERIOR | MARCA_INFERIOR,
+    [SEPARADOR_PUNTO] = MARCA_BASE,
+    [SEPARADOR_APOSTROFE] = MARCA_ALTA,
+};
+
 /* === Private function declarations =============================================================================== */
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Private variable definitions ================================================================================ */
 
+static struct panel_s instancias[MAXIMO_PANELES];
+
+static panel_geometria_t geometrias[GEOMETRIAS_CALCULADAS > 0 ? GEOMETRIAS_CALCULADAS : 1];
+
+static animacion_estadisticas_t estadisticas_animacion;
+
+static cambio_t pendientes[MAXIMO_CAMBIOS > 0 ? MAXIMO_CAMBIOS : 1];
+
+static uint8_t cantidad_pendientes;
+
+static uint8_t grupos_abiertos;
+
 /* === Private function definitions ================================================================================ */
 
 panel_t CrearInstancia(void) {
-    static struct panel_s instancias[MAXIMO_PANELES];
-
     for (int indice = 0; indice < MAXIMO_PANELES; indice++) {
         if (instancias[indice].digitos == 0) {
             return &(instancias[indice]);
@@ -100,68 +246,849 @@ panel_t CrearInstancia(void) {
     return NULL;
 }
 
-void CalcularGeometria(panel_t self) {
-
-    if (self->ancho == 0) {
-        self->ancho = (self->alto * 60) / 100;
+const panel_geometria_t * CalcularGeometria(uint16_t alto, uint16_t ancho, uint8_t cantidad) {
+    for (int indice = 0; indice < GEOMETRIAS_CALCULADAS; indice++) {
+        if (geometrias[indice].alto == 0) {
+            geometrias[indice] = (panel_geometria_t)GEOMETRIA_PANEL(alto, ancho, cantidad);
+            return &(geometrias[indice]);
+        }
     }
+    return NULL;
+}
 
-    uint16_t ancho_barra = (self->alto * 7) / 100;
-    uint16_t margen = (ancho_barra * 75) / 100;
-    uint16_t separacion = (self->alto * 2) / 100;
-
-    segmentos_t s = &(self->segmentos);
-
-    s->a.desde.x = s->d.desde.x = s->g.desde.x = margen + ancho_barra + separacion;
-    s->a.hasta.x = s->d.hasta.x = s->g.hasta.x = self->ancho - (margen + ancho_barra + separacion);
-    s->a.hasta.y = margen + ancho_barra;
-    s->g.desde.y = (self->alto - ancho_barra) / 2;
-    s->g.hasta.y = (self->alto + ancho_barra) / 2;
-    s->d.desde.y = self->alto - (margen + ancho_barra);
+void LiberarGeometria(const panel_geometria_t * geometria) {
+    for (int indice = 0; indice < GEOMETRIAS_CALCULADAS; indice++) {
+        if (geometria == &(geometrias[indice])) {
+            geometrias[indice].alto = 0;
+        }
+    }
+}
 
-    s->a.desde.y = s->b.desde.y = s->f.desde.y = margen;
-    s->b.hasta.y = s->f.hasta.y = (self->alto - separacion) / 2;
-    s->c.desde.y = s->e.desde.y = (self->alto + separacion) / 2;
-    s->d.hasta.y = s->c.hasta.y = s->e.hasta.y = self->alto - margen;
+uint16_t ColumnaDigito(panel_t self, uint8_t digito) {
+    uint16_t columna = self->origen.x + digito * self->ancho;
 
-    s->e.desde.x = s->f.desde.x = margen;
-    s->e.hasta.x = s->f.hasta.x = margen + ancho_barra;
-    s->b.desde.x = s->c.desde.x = self->ancho - margen;
-    s->b.hasta.x = s->c.hasta.x = self->ancho - (margen + ancho_barra);
+    for (uint8_t posicion = 0; posicion < digito; posicion++) {
+        if (self->separadores[posicion] != SEPARADOR_NINGUNO) {
+            columna += self->geometria->ancho_separador;
+        }
+    }
+    return columna;
 }
 
 void BorrarDigito(panel_t self, uint8_t digito) {
     struct area_s area;
 
-    area.desde.x = self->origen.x + digito * self->ancho;
+    area.desde.x = ColumnaDigito(self, digito);
     area.desde.y = self->origen.y;
-    area.hasta.x = self->origen.x + (digito + 1) * self->ancho;
+    area.hasta.x = area.desde.x + self->ancho;
     area.hasta.y = self->origen.y + self->alto;
 
     ILI9341DrawFilledRectangle(area.desde.x, area.desde.y, area.hasta.x, area.hasta.y, self->fondo);
 }
 
-void DibujarSegmento(panel_t self, uint8_t digito, area_t segmento, uint16_t color) {
+void DibujarSegmento(panel_t self, uint8_t digito, const struct area_s * segmento, uint16_t color) {
     struct area_s area;
 
-    area.desde.x = self->origen.x + digito * self->ancho + segmento->desde.x;
+    area.desde.x = ColumnaDigito(self, digito) + segmento->desde.x;
     area.desde.y = self->origen.y + segmento->desde.y;
-    area.hasta.x = self->origen.x + digito * self->ancho + segmento->hasta.x;
+    area.hasta.x = ColumnaDigito(self, digito) + segmento->hasta.x;
     area.hasta.y = self->origen.y + segmento->hasta.y;
 
     ILI9341DrawFilledRectangle(area.desde.x, area.desde.y, area.hasta.x, area.hasta.y, color);
 }
 
+const struct area_s * Segmento(panel_t self, uint8_t indice) {
+    return &(self->geometria->segmentos[indice]);
+}
+
+uint16_t Mascara(panel_t self, uint8_t simbolo) {
+    if (self->cantidad == 7) {
+        return DIGITOS[simbolo];
+    }
+    return ALFANUMERICOS[simbolo - PRIMER_CARACTER];
+}
+
+uint8_t SimboloDigito(panel_t self, uint8_t valor) {
+    if (self->cantidad == 7) {
+        return valor < SIMBOLO_APAGADO ? valor : SIMBOLO_APAGADO;
+    }
+    return valor < SIMBOLO_APAGADO ? HEXADECIMALES[valor] : CARACTER_APAGADO;
+}
+
+uint8_t SimboloCaracter(panel_t self, char caracter) {
+    if ((caracter >= 'a') && (caracter <= 'z')) {
+        caracter = caracter - 'a' + 'A';
+    }
+    if (self->cantidad == 7) {
+        const char * hexadecimal = memchr(HEXADECIMALES, caracter, sizeof(HEXADECIMALES) - 1);
+        return hexadecimal ? hexadecimal - HEXADECIMALES : SIMBOLO_APAGADO;
+    }
+    return (caracter >= PRIMER_CARACTER) && (caracter <= ULTIMO_CARACTER) ? caracter : CARACTER_APAGADO;
+}
+
+void Normalizar(const struct area_s * segmento, struct area_s * area) {
+    area->desde.x = segmento->desde.x < segmento->hasta.x ? segmento->desde.x : segmento->hasta.x;
+    area->hasta.x = segmento->desde.x < segmento->hasta.x ? segmento->hasta.x : segmento->desde.x;
+    area->desde.y = segmento->desde.y < segmento->hasta.y ? segmento->desde.y : segmento->hasta.y;
+    area->hasta.y = segmento->desde.y < segmento->hasta.y ? segmento->hasta.y : segmento->desde.y;
+}
+
+struct area_s * VentanasForma(panel_t self) {
+    return (struct area_s *)self->tabla;
+}
+
+uint16_t * TramosForma(panel_t self) {
+    return (uint16_t *)(VentanasForma(self) + self->cantidad);
+}
+
+void VentanaSegmento(panel_t self, uint8_t indice, struct area_s * ventana) {
+    /* Sin forma los tramos de cada fila, incluso los de las diagonales, llegan a los bordes del rectángulo */
+    if (self->forma == SEGMENTOS_RECTANGULARES) {
+        Normalizar(Segmento(self, indice), ventana);
+    } else {
+        *ventana = VentanasForma(self)[indice];
+    }
+}
+
+bool TramoSegmento(panel_t self, uint8_t indice, uint16_t y, int16_t * desde, int16_t * hasta) {
+    struct area_s area;
+    const int8_t * tramo;
+    int16_t centro, barra = Segmento(self, 0)->hasta.y - Segmento(self, 0)->desde.y;
+
+    Normalizar(Segmento(self, indice), &area);
+    if ((y < area.desde.y) || (y > area.hasta.y)) {
+        return false;
+    }
+    *desde = area.desde.x;
+    *hasta = area.hasta.x;
+    if (DIAGONALES[indice]) {
+        /* Las diagonales son tramos del ancho de un segmento que recorren su rectángulo de esquina a esquina */
+        centro = 0;
+        if (area.hasta.y > area.desde.y) {
+            centro = ((y - area.desde.y) * (area.hasta.x - area.desde.x)) / (area.hasta.y - area.desde.y);
+        }
+        if (DIAGONALES[indice] == DIAGONAL_ASCENDENTE) {
+            centro = (area.hasta.x - area.desde.x) - centro;
+        }
+        if (centro - barra / 2 > 0) {
+            *desde = area.desde.x + centro - barra / 2;
+        }
+        if (centro - barra / 2 + barra < area.hasta.x - area.desde.x) {
+            *hasta = area.desde.x + centro - barra / 2 + barra;
+        }
+    }
+    if (self->forma != SEGMENTOS_RECTANGULARES) {
+        tramo = &self->tabla[TramosForma(self)[indice] + 2 * (y - area.desde.y)];
+        *desde += tramo[0];
+        *hasta -= tramo[1];
+    }
+    if (*desde < 0) {
+        *desde = 0;
+    }
+    if (*hasta > self->ancho - 1) {
+        *hasta = self->ancho - 1;
+    }
+    return *desde <= *hasta;
+}
+
+bool CalcularTramos(panel_t self) {
+    struct area_s area, * ventana;
+    uint16_t usados, alto, ancho, extremo;
+    int16_t medio = self->alto / 2, margen = Segmento(self, 0)->desde.y, biselado, desplazamiento, desde, hasta;
+
+    /* Los tramos siguen a las ventanas y a las posiciones de los tramos de cada segmento */
+    usados = self->cantidad * (sizeof(struct area_s) + sizeof(uint16_t));
+    for (uint8_t indice = 0; indice < self->cantidad; indice++) {
+        Normalizar(Segmento(self, indice), &area);
+        alto = area.hasta.y - area.desde.y + 1;
+        ancho = area.hasta.x - area.desde.x + 1;
+        if (usados + 2 * alto > self->tabla_bytes) {
+            return false;
+        }
+        TramosForma(self)[indice] = usados;
+        ventana = &VentanasForma(self)[indice];
+        *ventana = area;
+        ventana->desde.x = self->ancho - 1;
+        ventana->hasta.x = 0;
+
+        for (uint16_t fila = 0; fila < alto; fila++) {
+            /* Los segmentos horizontales terminan en punta a los costados y los verticales arriba y abajo */
+            biselado = 0;
+            if ((self->forma & SEGMENTOS_BISELADOS) && !DIAGONALES[indice]) {
+                if (ancho > alto) {
+                    biselado = (2 * fila > alto - 1 ? 2 * fila - (alto - 1) : (alto - 1) - 2 * fila) / 2;
+                } else {
+                    extremo = fila < alto - 1 - fila ? fila : alto - 1 - fila;
+                    biselado = ancho / 2 > extremo ? ancho / 2 - extremo : 0;
+                }
+            }
+            /* La inclinación desplaza cada fila en proporción a su distancia al centro, como mucho el margen */
+            desplazamiento = 0;
+            if ((self->forma & SEGMENTOS_INCLINADOS) && (medio > 0)) {
+                desplazamiento = ((medio - (int16_t)(area.desde.y + fila)) * margen) / medio;
+            }
+            self->tabla[usados++] = biselado + desplazamiento;
+            self->tabla[usados++] = biselado - desplazamiento;
+
+            /* La ventana del segmento es el rectángulo que contiene todos sus tramos */
+            if (TramoSegmento(self, indice, area.desde.y + fila, &desde, &hasta)) {
+                if (desde < ventana->desde.x) {
+                    ventana->desde.x = desde;
+                }
+                if (hasta > ventana->hasta.x) {
+                    ventana->hasta.x = hasta;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void RasterizarFila(panel_t self, uint16_t mascara, uint16_t y, uint8_t * fila) {
+    int16_t desde, hasta;
+
+    memset(fila, SPRITE_FONDO, self->ancho);
+    for (uint8_t indice = 0; indice < self->cantidad; indice++) {
+        if (TramoSegmento(self, indice, y, &desde, &hasta)) {
+            memset(&fila[desde], mascara & (1 << indice) ? SPRITE_ENCENDIDO : SPRITE_APAGADO, hasta - desde + 1);
+        }
+    }
+}
+
+void ExpandirFila(uint8_t * buffer, const uint8_t * codigo, uint16_t ancho, const uint16_t * colores) {
+    uint16_t cantidad;
+
+    for (uint16_t x = 0; x < ancho; x += cantidad) {
+        cantidad = 1;
+        while ((x + cantidad < ancho) && (codigo[x + cantidad] == codigo[x])) {
+            cantidad++;
+        }
+        RGB565Fill(&buffer[x * 2], colores[codigo[x] >> 6], cantidad);
+    }
+}
+
+uint32_t ExpandirVentana(void * contexto, uint8_t * buffer, uint32_t pixeles) {
+    static uint8_t fila[SPRITE_ANCHO];
+    ventana_lector_t * lector = contexto;
+    uint32_t escritos = 0;
+    int16_t desde, hasta;
+
+    while ((lector->fila <= lector->hasta) && (escritos + lector->ancho <= pixeles)) {
+        RasterizarFila(lector->panel, lector->mascara, lector->fila, fila);
+        if (TramoSegmento(lector->panel, lector->indice, lector->fila, &desde, &hasta)) {
+            memset(&fila[desde], SPRITE_FUNDIDO, hasta - desde + 1);
+        }
+        ExpandirFila(&buffer[escritos * 2], &fila[lector->columna], lector->ancho, lector->colores);
+        lector->fila++;
+        escritos += lector->ancho;
+    }
+    return escritos;
+}
+
+void DibujarTramos(panel_t self, uint8_t digito, uint8_t indice, uint16_t mascara, uint16_t color) {
+    struct area_s ventana;
+    ventana_lector_t lector;
+
+    VentanaSegmento(self, indice, &ventana);
+    lector = (ventana_lector_t){
+        .panel = self,
+        .mascara = mascara,
+        .fila = ventana.desde.y,
+        .hasta = ventana.hasta.y,
+        .columna = ventana.desde.x,
+        .ancho = ventana.hasta.x - ventana.desde.x + 1,
+        .indice = indice,
+        .colores = {self->fondo, self->apagado, self->encendido, color},
+    };
+
+    /* La ventana se rellena con el estado de todo el digito, así que puede solaparse con los segmentos vecinos */
+    if (ventana.desde.x <= ventana.hasta.x) {
+        ILI9341DrawGenerated(ColumnaDigito(self, digito) + ventana.desde.x, self->origen.y + ventana.desde.y,
+                             lector.ancho, ventana.hasta.y - ventana.desde.y + 1, ExpandirVentana, &lector);
+    }
+}
+
+bool CalcularSprites(panel_t self) {
+    static uint8_t fila[SPRITE_ANCHO];
+    uint16_t usados = 0, franja = 0, largo = 0, tramos;
+
+    if ((self->memoria == NULL) || (self->cantidad != 7) || (self->ancho > SPRITE_ANCHO)) {
+        return false;
+    }
+    for (uint8_t valor = 0; valor < CANTIDAD_SIMBOLOS; valor++) {
+        self->sprites[valor] = usados;
+        for (uint16_t y = 0; y <= self->alto; y++) {
+            /* Dibuja la fila con el estado de cada pixel */
+            RasterizarFila(self, DIGITOS[valor], y, fila);
+
+            /* Codifica los tramos de la fila a continuación de los datos ya guardados */
+            tramos = usados + 1;
+            for (uint16_t x = 0, cantidad; x < self->ancho; x += cantidad) {
+                for (cantidad = 1; (x + cantidad < self->ancho) && (cantidad < SPRITE_TRAMO); cantidad++) {
+                    if (fila[x + cantidad] != fila[x]) {
+                        break;
+                    }
+                }
+                if (tramos >= self->memoria_bytes) {
+                    return false;
+                }
+                self->memoria[tramos++] = fila[x] | (cantidad - 1);
+            }
+
+            /* Si la fila es igual a la anterior se agrega a su franja, si no empieza una nueva */
+            if ((y > 0) && (self->memoria[franja] < SPRITE_FRANJA) && (tramos - usados - 1 == largo) &&
+                (memcmp(&self->memoria[franja + 1], &self->memoria[usados + 1], largo) == 0)) {
+                self->memoria[franja]++;
+            } else {
+                franja = usados;
+                largo = tramos - usados - 1;
+                self->memoria[franja] = 1;
+                usados = tramos;
+            }
+        }
+    }
+    return true;
+}
+
+uint32_t ExpandirSprite(void * contexto, uint8_t * buffer, uint32_t pixeles) {
+    sprite_lector_t * lector = contexto;
+    const uint8_t * codigo;
+    uint32_t escritos = 0;
+    uint16_t cantidad;
+
+    while ((lector->restantes > 0) && (escritos + lector->ancho <= pixeles)) {
+        if (lector->filas == 0) {
+            lector->franja = lector->siguiente;
+            lector->filas = lector->franja[0];
+        }
+        if ((escritos == 0) || (lector->filas == lector->franja[0])) {
+            /* La primera fila de cada franja y de cada buffer se expande de los tramos */
+            codigo = &lector->franja[1];
+            for (uint16_t x = 0; x < lector->ancho; x += cantidad, codigo++) {
+                cantidad = (*codigo & (SPRITE_TRAMO - 1)) + 1;
+                RGB565Fill(&buffer[(escritos + x) * 2], lector->colores[*codigo >> 6], cantidad);
+            }
+            lector->siguiente = codigo;
+        } else {
+            /* El resto de las filas de la franja son copias de la anterior */
+            memcpy(&buffer[escritos * 2], &buffer[(escritos - lector->ancho) * 2], lector->ancho * 2);
+        }
+        lector->filas--;
+        lector->restantes--;
+        escritos += lector->ancho;
+    }
+    return escritos;
+}
+
+void DibujarSprite(panel_t self, uint8_t digito, uint8_t valor) {
+    sprite_lector_t lector = {
+        .siguiente = &self->memoria[self->sprites[valor]],
+        .restantes = self->alto + 1,
+        .ancho = self->ancho,
+        .colores = {self->fondo, self->apagado, self->encendido},
+    };
+
+    ILI9341DrawGenerated(ColumnaDigito(self, digito), self->origen.y, self->ancho, self->alto + 1, ExpandirSprite,
+                         &lector);
+}
+
+bool Rectangular(panel_t self, uint8_t indice) {
+    if (indice == CAMBIO_SPRITE) {
+        return false;
+    }
+    return (indice >= CAMBIO_MARCA) || ((self->forma == SEGMENTOS_RECTANGULARES) && !DIAGONALES[indice]);
+}
+
+bool AreaCambio(panel_t self, uint8_t posicion, uint8_t indice, struct area_s * area) {
+    uint16_t columna = ColumnaDigito(self, posicion);
+
+    if (indice == CAMBIO_SPRITE) {
+        *area = (struct area_s){{0, 0}, {self->ancho - 1, self->alto}};
+    } else if (indice >= CAMBIO_MARCA) {
+        Normalizar(&(self->geometria->marcas[indice - CAMBIO_MARCA]), area);
+        columna += self->ancho;
+    } else {
+        VentanaSegmento(self, indice, area);
+    }
+    area->desde.x += columna;
+    area->hasta.x += columna;
+    area->desde.y += self->origen.y;
+    area->hasta.y += self->origen.y;
+    return area->desde.x <= area->hasta.x;
+}
+
+uint16_t ColorCambio(const cambio_t * cambio) {
+    panel_t self = cambio->panel;
+
+    if (cambio->indice >= CAMBIO_MARCA) {
+        return self->puntos[cambio->posicion] ? self->encendido : self->apagado;
+    }
+    return self->mascaras[cambio->posicion] & (1 << cambio->indice) ? self->encendido : self->apagado;
+}
+
+bool DescartarCambios(panel_t self, uint8_t posicion) {
+    uint8_t quedan = 0;
+    bool descartados = false;
+
+    for (uint8_t orden = 0; orden < cantidad_pendientes; orden++) {
+        if ((pendientes[orden].panel == self) &&
+            ((posicion == TODOS_DIGITOS) ||
+             ((pendientes[orden].posicion == posicion) &&
+              ((pendientes[orden].indice < CAMBIO_MARCA) || (pendientes[orden].indice == CAMBIO_SPRITE))))) {
+            descartados = true;
+        } else {
+            pendientes[quedan++] = pendientes[orden];
+        }
+    }
+    cantidad_pendientes = quedan;
+    return descartados;
+}
+
+bool MismasFilas(const struct area_s * area, const struct area_s * otra) {
+    return (area->desde.y == otra->desde.y) && (area->hasta.y == otra->hasta.y);
+}
+
+bool MismasColumnas(const struct area_s * area, const struct area_s * otra) {
+    return (area->desde.x == otra->desde.x) && (area->hasta.x == otra->hasta.x);
+}
+
+bool Solapados(const struct area_s * area, const struct area_s * otra) {
+    return (area->desde.x <= otra->hasta.x) && (otra->desde.x <= area->hasta.x) && (area->desde.y <= otra->hasta.y) &&
+           (otra->desde.y <= area->hasta.y);
+}
+
+bool Adelantable(uint8_t desde, uint8_t cambio) {
+    for (uint8_t orden = desde; orden < cambio; orden++) {
+        if (Solapados(&pendientes[orden].area, &pendientes[cambio].area)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void OrdenarCambios(void) {
+    cambio_t cambio;
+    uint8_t orden, anterior, elegido, columnas;
+
+    /* Ordena por filas y después por columnas, así los cambios que comparten filas quedan seguidos. Los rectángulos que
+     * se solapan, como los extremos de los segmentos de un digito, mantienen su orden para que gane el último */
+    for (orden = 1; orden < cantidad_pendientes; orden++) {
+        cambio = pendientes[orden];
+        for (anterior = orden; anterior > 0; anterior--) {
+            const struct area_s * area = &pendientes[anterior - 1].area;
+            if (Solapados(area, &cambio.area) || (area->desde.y < cambio.area.desde.y) ||
+                ((area->desde.y == cambio.area.desde.y) &&
+                 ((area->hasta.y < cambio.area.hasta.y) ||
+                  ((area->hasta.y == cambio.area.hasta.y) && (area->desde.x <= cambio.area.desde.x))))) {
+                break;
+            }
+            pendientes[anterior] = pendientes[anterior - 1];
+        }
+        pendientes[anterior] = cambio;
+    }
+
+    /* Después de cada cambio se adelanta uno con sus mismas filas, o si no hay con sus mismas columnas, porque la
+     * pantalla conserva la parte de la ventana que no se vuelve a enviar */
+    for (orden = 1; orden < cantidad_pendientes; orden++) {
+        elegido = columnas = cantidad_pendientes;
+        for (anterior = orden; (anterior < cantidad_pendientes) && (elegido == cantidad_pendientes); anterior++) {
+            if (!Adelantable(orden, anterior)) {
+                continue;
+            }
+            if (MismasFilas(&pendientes[orden - 1].area, &pendientes[anterior].area)) {
+                elegido = anterior;
+            } else if ((columnas == cantidad_pendientes) &&
+                       MismasColumnas(&pendientes[orden - 1].area, &pendientes[anterior].area)) {
+                columnas = anterior;
+            }
+        }
+        if (elegido == cantidad_pendientes) {
+            elegido = columnas < cantidad_pendientes ? columnas : orden;
+        }
+        cambio = pendientes[elegido];
+        for (anterior = elegido; anterior > orden; anterior--) {
+            pendientes[anterior] = pendientes[anterior - 1];
+        }
+        pendientes[orden] = cambio;
+    }
+}
+
+bool Unible(const cambio_t * cambio, const struct area_s * area, uint16_t color) {
+    return Rectangular(cambio->panel, cambio->indice) && MismasFilas(&cambio->area, area) &&
+           (cambio->area.desde.x <= area->hasta.x + 1) && (cambio->area.hasta.x + 1 >= area->desde.x) &&
+           (ColorCambio(cambio) == color);
+}
+
+void DibujarCambios(void) {
+    cambio_t cambio;
+    struct area_s area;
+    uint16_t color;
+    uint8_t orden;
+
+    if (cantidad_pendientes == 0) {
+        return;
+    }
+    OrdenarCambios();
+
+    ILI9341BeginBatch();
+    for (orden = 0; orden < cantidad_pendientes; orden++) {
+        cambio = pendientes[orden];
+        if (cambio.indice == CAMBIO_SPRITE) {
+            DibujarSprite(cambio.panel, cambio.posicion, cambio.panel->valores[cambio.posicion]);
+        } else if (!Rectangular(cambio.panel, cambio.indice)) {
+            DibujarTramos(cambio.panel, cambio.posicion, cambio.indice, cambio.panel->mascaras[cambio.posicion],
+                          ColorCambio(&cambio));
+        } else {
+            /* Los rectángulos que siguen en las mismas filas, pegados y del mismo color se envían juntos */
+            area = cambio.area;
+            color = ColorCambio(&cambio);
+            while ((orden + 1 < cantidad_pendientes) && Unible(&pendientes[orden + 1], &area, color)) {
+                orden++;
+                if (pendientes[orden].area.desde.x < area.desde.x) {
+                    area.desde.x = pendientes[orden].area.desde.x;
+                }
+                if (pendientes[orden].area.hasta.x > area.hasta.x) {
+                    area.hasta.x = pendientes[orden].area.hasta.x;
+                }
+            }
+            ILI9341DrawFilledRectangle(area.desde.x, area.desde.y, area.hasta.x, area.hasta.y, color);
+        }
+    }
+    ILI9341EndBatch();
+    cantidad_pendientes = 0;
+}
+
+void AgregarCambio(panel_t self, uint8_t posicion, uint8_t indice) {
+    cambio_t cambio = {.panel = self, .posicion = posicion, .indice = indice};
+
+    if (!AreaCambio(self, posicion, indice, &cambio.area)) {
+        return;
+    }
+    /* El color se toma al confirmar, así que un segmento que cambia varias veces se anota una sola */
+    for (uint8_t orden = 0; orden < cantidad_pendientes; orden++) {
+        if ((pendientes[orden].panel == self) && (pendientes[orden].posicion == posicion) &&
+            (pendientes[orden].indice == indice)) {
+            return;
+        }
+    }
+    if (cantidad_pendientes >= MAXIMO_CAMBIOS) {
+        DibujarCambios();
+    }
+    pendientes[cantidad_pendientes++] = cambio;
+}
+
+void DibujarSeparador(panel_t self, uint8_t posicion) {
+    uint16_t columna = ColumnaDigito(self, posicion) + self->ancho;
+    uint8_t marcas = SEPARADORES[self->separadores[posicion]];
+    uint16_t color = self->puntos[posicion] ? self->encendido : self->apagado;
+    const struct area_s * marca;
+
+    /* Igual que con los segmentos, no se envía nada si el separador no cambia */
+    if (marcas == 0) {
+        return;
+    }
+    if (self->dibujados[posicion] == self->puntos[posicion]) {
+        self->estadisticas.omitidas++;
+        return;
+    }
+    if (self->dibujados[posicion] == SIN_MARCAR) {
+        ILI9341DrawFilledRectangle(columna, self->origen.y, columna + self->geometria->ancho_separador - 1,
+                                   self->origen.y + self->alto, self->fondo);
+    }
+    self->dibujados[posicion] = self->puntos[posicion];
+    self->estadisticas.actualizaciones++;
+
+    for (uint8_t indice = 0; indice < sizeof(self->geometria->marcas) / sizeof(self->geometria->marcas[0]); indice++) {
+        if ((marcas & (1 << indice)) && (grupos_abiertos > 0)) {
+            AgregarCambio(self, posicion, CAMBIO_MARCA + indice);
+            self->estadisticas.segmentos++;
+        } else if (marcas & (1 << indice)) {
+            marca = &(self->geometria->marcas[indice]);
+            ILI9341DrawFilledRectangle(columna + marca->desde.x, self->origen.y + marca->desde.y,
+                                       columna + marca->hasta.x, self->origen.y + marca->hasta.y, color);
+            self->estadisticas.segmentos++;
+        }
+    }
+}
+
+void RasterizarRodado(panel_t self, const transicion_t * transicion, uint8_t paso, uint16_t y, uint8_t * fila) {
+    uint16_t origen = y + (paso * (self->alto + 1)) / self->pasos;
+
+    if (origen <= self->alto) {
+        RasterizarFila(self, transicion->anterior, origen, fila);
+    } else {
+        RasterizarFila(self, transicion->destino, origen - (self->alto + 1), fila);
+    }
+}
+
+uint32_t ExpandirRodado(void * contexto, uint8_t * buffer, uint32_t pixeles) {
+    static uint8_t fila[SPRITE_ANCHO];
+    rodado_lector_t * lector = contexto;
+    uint16_t ancho = lector->panel->ancho;
+    uint32_t escritos = 0;
+
+    while ((lector->fila <= lector->hasta) && (escritos + ancho <= pixeles)) {
+        RasterizarRodado(lector->panel, lector->transicion, lector->transicion->paso, lector->fila++, fila);
+        ExpandirFila(&buffer[escritos * 2], fila, ancho, lector->colores);
+        escritos += ancho;
+    }
+    return escritos;
+}
+
+uint16_t FranjasRodado(panel_t self, const transicion_t * transicion, franja_t * franjas, uint8_t * cantidad) {
+    static uint8_t antes[SPRITE_ANCHO], ahora[SPRITE_ANCHO];
+    uint16_t filas = 0;
+    bool distinta;
+
+    /* Solo se envían las filas que cambian respecto al último paso dibujado, agrupadas en franjas contiguas */
+    *cantidad = 0;
+    for (uint16_t y = 0; y <= self->alto; y++) {
+        distinta = (transicion->dibujado == SIN_PASO);
+        if (!distinta) {
+            RasterizarRodado(self, transicion, transicion->dibujado, y, antes);
+            RasterizarRodado(self, transicion, transicion->paso, y, ahora);
+            distinta = memcmp(antes, ahora, self->ancho) != 0;
+        }
+        if (!distinta) {
+            continue;
+        }
+        if ((*cantidad > 0) && ((franjas[*cantidad - 1].hasta + 1 == y) || (*cantidad == MAXIMO_FRANJAS))) {
+            /* Con demasiadas franjas la última se extiende, reenviando las filas iguales que quedan en el medio */
+            filas += y - franjas[*cantidad - 1].hasta;
+            franjas[*cantidad - 1].hasta = y;
+        } else {
+            franjas[*cantidad].desde = franjas[*cantidad].hasta = y;
+            (*cantidad)++;
+            filas++;
+        }
+    }
+    return filas;
+}
+
+void DibujarRodado(panel_t self, uint8_t posicion, const franja_t * franjas, uint8_t cantidad) {
+    rodado_lector_t lector = {
+        .panel = self,
+        .transicion = &self->transiciones[posicion],
+        .colores = {self->fondo, self->apagado, self->encendido},
+    };
+
+    for (uint8_t franja = 0; franja < cantidad; franja++) {
+        lector.fila = franjas[franja].desde;
+        lector.hasta = franjas[franja].hasta;
+        ILI9341DrawGenerated(ColumnaDigito(self, posicion), self->origen.y + franjas[franja].desde, self->ancho,
+                             franjas[franja].hasta - franjas[franja].desde + 1, ExpandirRodado, &lector);
+    }
+}
+
+uint16_t CambiosFundido(panel_t self, const transicion_t * transicion) {
+    if (transicion->dibujado == SIN_PASO) {
+        return (1 << self->cantidad) - 1;
+    }
+    return transicion->anterior ^ transicion->destino;
+}
+
+uint32_t BytesFundido(panel_t self, uint16_t cambios) {
+    struct area_s ventana;
+    uint32_t bytes = 0;
+
+    for (uint8_t indice = 0; indice < self->cantidad; indice++) {
+        VentanaSegmento(self, indice, &ventana);
+        if ((cambios & (1 << indice)) && (ventana.desde.x <= ventana.hasta.x)) {
+            bytes += 2 * (ventana.hasta.x - ventana.desde.x + 1) * (ventana.hasta.y - ventana.desde.y + 1);
+        }
+    }
+    return bytes;
+}
+
+uint16_t ColorFundido(panel_t self, const transicion_t * transicion, uint8_t indice) {
+    uint16_t segmento = 1 << indice;
+    uint8_t alfa = (transicion->paso * RGB565_ALPHA_MAX) / self->pasos;
+
+    if (!((transicion->anterior ^ transicion->destino) & segmento)) {
+        return transicion->destino & segmento ? self->encendido : self->apagado;
+    }
+    if (transicion->destino & segmento) {
+        return RGB565BlendColor(self->encendido, self->apagado, alfa);
+    }
+    return RGB565BlendColor(self->apagado, self->encendido, alfa);
+}
+
+void DibujarFundido(panel_t self, uint8_t posicion, uint16_t cambios) {
+    const transicion_t * transicion = &self->transiciones[posicion];
+
+    /* Cada segmento que cambia se dibuja con su color intermedio y el resto del digito con su estado final */
+    for (uint8_t indice = 0; indice < self->cantidad; indice++) {
+        if (cambios & (1 << indice)) {
+            if ((self->forma == SEGMENTOS_RECTANGULARES) && !DIAGONALES[indice]) {
+                DibujarSegmento(self, posicion, Segmento(self, indice), ColorFundido(self, transicion, indice));
+            } else {
+                DibujarTramos(self, posicion, indice, transicion->destino, ColorFundido(self, transicion, indice));
+            }
+            self->estadisticas.segmentos++;
+        }
+    }
+}
+
+void IniciarTransicion(panel_t self, uint8_t posicion, uint16_t segmentos) {
+    transicion_t * transicion = &self->transiciones[posicion];
+
+    /* Si el digito cambia en medio de una transición o con cambios sin enviar la nueva se envía completa */
+    transicion->dibujado = DescartarCambios(self, posicion) || transicion->activa ? SIN_PASO : 0;
+    transicion->anterior = self->mascaras[posicion];
+    transicion->destino = segmentos;
+    transicion->paso = 0;
+    transicion->activa = true;
+    self->mascaras[posicion] = segmentos;
+    self->estadisticas.actualizaciones++;
+}
+
+uint32_t AnimarDigito(panel_t self, uint8_t posicion, uint32_t enviados, uint32_t presupuesto) {
+    transicion_t * transicion = &self->transiciones[posicion];
+    franja_t franjas[MAXIMO_FRANJAS];
+    uint8_t cantidad = 0;
+    uint16_t cambios = 0;
+    uint32_t bytes;
+
+    /* La transición avanza en cada cuadro, se dibuje o no */
+    if (transicion->paso < self->pasos) {
+        transicion->paso++;
+    }
+    if (self->animacion == ANIMACION_RODAR) {
+        bytes = 2 * self->ancho * FranjasRodado(self, transicion, franjas, &cantidad);
+    } else {
+        cambios = CambiosFundido(self, transicion);
+        bytes = BytesFundido(self, cambios);
+    }
+    if ((enviados > 0) && (enviados + bytes > presupuesto)) {
+        estadisticas_animacion.saltados++;
+        return 0;
+    }
+
+    if (self->animacion == ANIMACION_RODAR) {
+        DibujarRodado(self, posicion, franjas, cantidad);
+    } else {
+        DibujarFundido(self, posicion, cambios);
+    }
+    transicion->dibujado = transicion->paso;
+    transicion->activa = transicion->paso < self->pasos;
+    estadisticas_animacion.pasos++;
+    return bytes;
+}
+
+void DibujarMascara(panel_t self, uint8_t posicion, uint16_t segmentos) {
+    uint16_t cambios;
+
+    /* Solo se redibujan los segmentos que cambian de estado respecto a lo que muestra la pantalla */
+    if (self->mascaras[posicion] == segmentos) {
+        self->estadisticas.omitidas++;
+        return;
+    }
+    if ((self->animacion != ANIMACION_NINGUNA) && (self->mascaras[posicion] != SIN_DIBUJAR)) {
+        /* El cambio se dibuja de a pasos en los próximos cuadros de animación */
+        IniciarTransicion(self, posicion, segmentos);
+        return;
+    }
+    self->transiciones[posicion].activa = false;
+    if (self->predibujado && (grupos_abiertos > 0)) {
+        AgregarCambio(self, posicion, CAMBIO_SPRITE);
+        self->mascaras[posicion] = segmentos;
+        self->estadisticas.actualizaciones++;
+        return;
+    }
+    if (self->predibujado) {
+        /* El digito completo se envía en una sola ventana */
+        DibujarSprite(self, posicion, self->valores[posicion]);
+        self->mascaras[posicion] = segmentos;
+        self->estadisticas.actualizaciones++;
+        return;
+    }
+    if (self->mascaras[posicion] == SIN_DIBUJAR) {
+        BorrarDigito(self, posicion);
+        cambios = (1 << self->cantidad) - 1;
+    } else {
+        cambios = self->mascaras[posicion] ^ segmentos;
+    }
+    self->mascaras[posicion] = segmentos;
+    self->estadisticas.actualizaciones++;
+
+    for (uint8_t indice = 0; indice < self->cantidad; indice++) {
+        if (cambios & (1 << indice)) {
+            if (grupos_abiertos > 0) {
+                AgregarCambio(self, posicion, indice);
+            } else if ((self->forma == SEGMENTOS_RECTANGULARES) && !DIAGONALES[indice]) {
+                DibujarSegmento(self, posicion, Segmento(self, indice),
+                                segmentos & (1 << indice) ? self->encendido : self->apagado);
+            } else {
+                DibujarTramos(self, posicion, indice, segmentos,
+                              segmentos & (1 << indice) ? self->encendido : self->apagado);
+            }
+            self->estadisticas.segmentos++;
+        }
+    }
+}
+
+panel_t CrearPanelCalculado(uint16_t x, uint16_t y, uint16_t digitos, uint16_t alto, uint16_t ancho,
+                            uint16_t encendido, uint16_t apagado, uint16_t fondo, uint8_t cantidad) {
+    const panel_geometria_t * geometria = CalcularGeometria(alto, ancho, cantidad);
+    panel_t self = NULL;
+
+#if GEOMETRIAS_CALCULADAS == 0
+    /* Un error de configuración, no de memoria: el panel tiene que crearse con CrearPanelGeometria */
+    ESP_LOGE("DIGITOS", "Panel de %ux%u sin geometria, compilado con GEOMETRIAS_CALCULADAS=0", alto, ancho);
+    assert(GEOMETRIAS_CALCULADAS > 0);
+#else
+    if (!geometria) {
+        ESP_LOGE("DIGITOS", "Panel de %ux%u sin geometria, se usan las %d de GEOMETRIAS_CALCULADAS", alto, ancho,
+                 GEOMETRIAS_CALCULADAS);
+    }
+#endif
+    if (geometria) {
+        self = CrearPanelGeometria(x, y, digitos, geometria, encendido, apagado, fondo);
+        if (!self) {
+            LiberarGeometria(geometria);
+        }
+    }
+    return self;
+}
+
+void RedibujarPanel(panel_t self) {
+    /* Los cambios anotados pueden tener la posición de antes, el panel completo se vuelve a anotar o dibujar */
+    DescartarCambios(self, TODOS_DIGITOS);
+    for (int posicion = 0; posicion < self->digitos; posicion++) {
+        self->mascaras[posicion] = SIN_DIBUJAR;
+        self->dibujados[posicion] = SIN_MARCAR;
+        DibujarMascara(self, posicion, Mascara(self, self->valores[posicion]));
+        DibujarSeparador(self, posicion);
+    }
+}
+
 /* === Public function implementation ============================================================================== */
 
 panel_t CrearPanel(uint16_t x, uint16_t y, uint16_t digitos, uint16_t alto, uint16_t ancho, uint16_t encendido,
                    uint16_t apagado, uint16_t fondo) {
-    panel_t self = CrearInstancia();
+    return CrearPanelCalculado(x, y, digitos, alto, ancho, encendido, apagado, fondo, 7);
+}
+
+panel_t CrearPanelAlfanumerico(uint16_t x, uint16_t y, uint16_t caracteres, uint16_t alto, uint16_t ancho,
+                               uint16_t encendido, uint16_t apagado, uint16_t fondo) {
+    return CrearPanelCalculado(x, y, caracteres, alto, ancho, encendido, apagado, fondo, 14);
+}
+
+panel_t CrearPanelGeometria(uint16_t x, uint16_t y, uint16_t digitos, const panel_geometria_t * geometria,
+                            uint16_t encendido, uint16_t apagado, uint16_t fondo) {
+    panel_t self = NULL;
+
+    /* Las filas de los segmentos con forma, diagonales o animados se arman en buffers de SPRITE_ANCHO pixeles */
+    if (geometria->ancho <= SPRITE_ANCHO) {
+        self = CrearInstancia();
+    }
     if (self) {
         self->origen.x = x;
         self->origen.y = y;
-        self->alto = alto;
-        self->ancho = ancho;
+        self->geometria = geometria;
+        self->alto = geometria->alto;
+        self->ancho = geometria->ancho;
+        self->cantidad = geometria->cantidad;
 
         if (digitos > MAXIMO_DIGITOS) {
             self->digitos = MAXIMO_DIGITOS;
@@ -175,33 +1102,227 @@ panel_t CrearPanel(uint16_t x, uint16_t y, uint16_t digitos, uint16_t alto, uint
         self->apagado = apagado;
         self->fondo = fondo;
 
-        CalcularGeometria(self);
-    }
+        for (int i = 0; i < MAXIMO_DIGITOS; i++) {
+            self->mascaras[i] = SIN_DIBUJAR;
+            self->separadores[i] = SEPARADOR_NINGUNO;
+            self->puntos[i] = false;
+            self->dibujados[i] = SIN_MARCAR;
+        }
+        self->estadisticas = (panel_estadisticas_t){0};
+        self->predibujado = false;
+        self->memoria = NULL;
+        self->memoria_bytes = 0;
+        self->animacion = ANIMACION_NINGUNA;
+        self->pasos = 1;
+        memset(self->transiciones, 0, sizeof(self->transiciones));
+        self->forma = SEGMENTOS_RECTANGULARES;
+        self->tabla = NULL;
+        self->tabla_bytes = 0;
 
-    for (int i = 0; i < self->digitos; i++) {
-        DibujarDigito(self, i, 0xFF);
+        for (int i = 0; i < self->digitos; i++) {
+            DibujarDigito(self, i, 0xFF);
+        }
     }
     return self;
 }
 
+void DestruirPanel(panel_t self) {
+    if (self) {
+        DescartarCambios(self, TODOS_DIGITOS);
+        self->digitos = 0;
+        self->predibujado = false;
+        self->memoria = NULL;
+        self->tabla = NULL;
+        LiberarGeometria(self->geometria);
+    }
+}
+
 void DibujarDigito(panel_t self, uint8_t posicion, uint8_t valor) {
     if (posicion < self->digitos) {
-        uint8_t segmentos;
+        self->valores[posicion] = SimboloDigito(self, valor);
+        DibujarMascara(self, posicion, Mascara(self, self->valores[posicion]));
+    }
+}
+
+void DibujarCaracter(panel_t self, uint8_t posicion, char caracter) {
+    if (posicion < self->digitos) {
+        self->valores[posicion] = SimboloCaracter(self, caracter);
+        DibujarMascara(self, posicion, Mascara(self, self->valores[posicion]));
+    }
+}
+
+void PanelMostrarNumero(panel_t self, uint32_t valor, uint8_t base, bool ceros) {
+    uint8_t valores[MAXIMO_DIGITOS];
+    bool cambios = false;
+
+    if (base < 2) {
+        base = 2;
+    } else if (base > 16) {
+        base = 16;
+    }
+
+    /* Separa todos los digitos antes de dibujar, empezando por el menos significativo a la derecha */
+    for (int posicion = self->digitos - 1; posicion >= 0; posicion--) {
+        valores[posicion] = valor % base;
+        valor = valor / base;
+    }
+    for (int posicion = 0; !ceros && (posicion < self->digitos - 1) && (valores[posicion] == 0); posicion++) {
+        valores[posicion] = SIMBOLO_APAGADO;
+    }
+
+    /* Los digitos que cambian se envían juntos en una sola sesión del bus */
+    for (int posicion = 0; posicion < self->digitos; posicion++) {
+        valores[posicion] = SimboloDigito(self, valores[posicion]);
+        cambios = cambios || (self->mascaras[posicion] != Mascara(self, valores[posicion]));
+    }
+    if (cambios) {
+        ILI9341BeginBatch();
+    }
+    for (int posicion = 0; posicion < self->digitos; posicion++) {
+        self->valores[posicion] = valores[posicion];
+        DibujarMascara(self, posicion, Mascara(self, valores[posicion]));
+    }
+    if (cambios) {
+        ILI9341EndBatch();
+    }
+}
+
+void PanelMostrarTexto(panel_t self, const char * texto) {
+    uint8_t valores[MAXIMO_DIGITOS];
+    bool cambios = false;
+
+    /* Los digitos que sobran a la derecha del texto se apagan */
+    for (int posicion = 0; posicion < self->digitos; posicion++) {
+        valores[posicion] = SimboloCaracter(self, *texto ? *texto++ : ' ');
+        cambios = cambios || (self->mascaras[posicion] != Mascara(self, valores[posicion]));
+    }
+    if (cambios) {
+        ILI9341BeginBatch();
+    }
+    for (int posicion = 0; posicion < self->digitos; posicion++) {
+        self->valores[posicion] = valores[posicion];
+        DibujarMascara(self, posicion, Mascara(self, valores[posicion]));
+    }
+    if (cambios) {
+        ILI9341EndBatch();
+    }
+}
+
+void PanelEstadisticas(panel_t self, panel_estadisticas_t * estadisticas) {
+    *estadisticas = self->estadisticas;
+}
+
+bool PanelPredibujarDigitos(panel_t self, uint8_t * memoria, uint16_t bytes) {
+    self->memoria = memoria;
+    self->memoria_bytes = memoria ? bytes : 0;
+    self->predibujado = CalcularSprites(self);
+    return self->predibujado;
+}
+
+bool PanelFormaSegmentos(panel_t self, uint8_t forma, int8_t * memoria, uint16_t bytes) {
+    /* Las ventanas del principio de la tabla necesitan la alineación de sus coordenadas */
+    uint8_t relleno = (uintptr_t)memoria % sizeof(uint16_t);
+
+    forma = forma & (SEGMENTOS_BISELADOS | SEGMENTOS_INCLINADOS);
+    self->tabla = (memoria && (bytes > relleno)) ? memoria + relleno : NULL;
+    self->tabla_bytes = self->tabla ? bytes - relleno : 0;
+    self->forma = forma;
+    if ((forma != SEGMENTOS_RECTANGULARES) && !CalcularTramos(self)) {
+        self->forma = SEGMENTOS_RECTANGULARES;
+    }
+    if (self->predibujado) {
+        self->predibujado = CalcularSprites(self);
+    }
+    RedibujarPanel(self);
+    return self->forma == forma;
+}
+
+void PanelSeparador(panel_t self, uint8_t posicion, uint8_t tipo) {
+    if ((posicion < self->digitos) && (tipo < sizeof(SEPARADORES))) {
+        self->separadores[posicion] = tipo;
+        RedibujarPanel(self);
+    }
+}
+
+void PanelEncenderSeparador(panel_t self, uint8_t posicion, bool encendido) {
+    if (posicion < self->digitos) {
+        self->puntos[posicion] = encendido;
+        DibujarSeparador(self, posicion);
+    }
+}
 
-        self->valores[posicion] = valor;
-        if (valor > sizeof(DIGITOS)) {
-            self->valores[posicion] = sizeof(DIGITOS);
+bool PanelAnimacion(panel_t self, uint8_t tipo, uint8_t pasos) {
+    bool activas = false;
+
+    for (int posicion = 0; posicion < self->digitos; posicion++) {
+        activas = activas || self->transiciones[posicion].activa;
+    }
+    self->animacion = (tipo <= ANIMACION_FUNDIR) && (self->ancho <= SPRITE_ANCHO) ? tipo : ANIMACION_NINGUNA;
+    self->pasos = pasos > 0 ? pasos : 1;
+
+    /* Las transiciones en curso no pueden seguir con otro tipo o cantidad de pasos, terminan de una vez */
+    if (activas) {
+        RedibujarPanel(self);
+    }
+    return self->animacion == tipo;
+}
+
+bool AnimarPaneles(uint32_t presupuesto) {
+    static uint16_t inicio = 0;
+    const uint16_t total = MAXIMO_PANELES * MAXIMO_DIGITOS;
+    int64_t comienzo = esp_timer_get_time();
+    uint32_t enviados = 0, saltados = estadisticas_animacion.saltados, duracion;
+    uint16_t siguiente = inicio;
+    bool pendientes = false, sesion = false;
+    panel_t self;
+    uint8_t posicion;
+
+    /* Cada cuadro empieza por el primer digito que se salteó en el anterior, así ninguno queda siempre afuera */
+    for (uint16_t orden = 0; orden < total; orden++) {
+        self = &instancias[((inicio + orden) % total) / MAXIMO_DIGITOS];
+        posicion = ((inicio + orden) % total) % MAXIMO_DIGITOS;
+        if ((posicion >= self->digitos) || !self->transiciones[posicion].activa) {
+            continue;
+        }
+        if (!sesion) {
+            ILI9341BeginBatch();
+            sesion = true;
         }
-        segmentos = DIGITOS[self->valores[posicion]];
+        enviados += AnimarDigito(self, posicion, enviados, presupuesto);
+        if ((estadisticas_animacion.saltados != saltados) && (siguiente == inicio)) {
+            siguiente = (inicio + orden) % total;
+        }
+        pendientes = pendientes || self->transiciones[posicion].activa;
+    }
+    if (sesion) {
+        ILI9341EndBatch();
+    }
+    inicio = siguiente;
 
-        BorrarDigito(self, posicion);
-        DibujarSegmento(self, posicion, &(self->segmentos.a), segmentos & SEGMENTO_A ? self->encendido : self->apagado);
-        DibujarSegmento(self, posicion, &(self->segmentos.b), segmentos & SEGMENTO_B ? self->encendido : self->apagado);
-        DibujarSegmento(self, posicion, &(self->segmentos.c), segmentos & SEGMENTO_C ? self->encendido : self->apagado);
-        DibujarSegmento(self, posicion, &(self->segmentos.d), segmentos & SEGMENTO_D ? self->encendido : self->apagado);
-        DibujarSegmento(self, posicion, &(self->segmentos.e), segmentos & SEGMENTO_E ? self->encendido : self->apagado);
-        DibujarSegmento(self, posicion, &(self->segmentos.f), segmentos & SEGMENTO_F ? self->encendido : self->apagado);
-        DibujarSegmento(self, posicion, &(self->segmentos.g), segmentos & SEGMENTO_G ? self->encendido : self->apagado);
+    duracion = esp_timer_get_time() - comienzo;
+    estadisticas_animacion.cuadros++;
+    estadisticas_animacion.bytes = enviados;
+    estadisticas_animacion.duracion = duracion;
+    if (enviados > estadisticas_animacion.bytes_maximo) {
+        estadisticas_animacion.bytes_maximo = enviados;
+    }
+    if (duracion > estadisticas_animacion.duracion_maxima) {
+        estadisticas_animacion.duracion_maxima = duracion;
+    }
+    return pendientes;
+}
+
+void EstadisticasAnimacion(animacion_estadisticas_t * estadisticas) {
+    *estadisticas = estadisticas_animacion;
+}
+
+void AgruparCambios(void) {
+    grupos_abiertos++;
+}
+
+void ConfirmarCambios(void) {
+    if ((grupos_abiertos > 0) && (--grupos_abiertos == 0)) {
+        DibujarCambios();
     }
 }
 
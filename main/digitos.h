@@ -21,11 +21,12 @@ SPDX-License-Identifier: MIT
 #define DIGITOS_H_
 
 /** @file digitos.h
- ** @brief Declaraciones de la biblioteca para dibujar paneles con digitos de 7 segmentos en una pantalla TFT
+ ** @brief Declaraciones de la biblioteca para dibujar paneles con digitos de 7 y 14 segmentos en una pantalla TFT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 /* === Cabecera C++ ================================================================================================ */
@@ -36,21 +37,186 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
-//! @brief Cantidad máxima de paneles que se pueden crear
+//! @brief Cantidad máxima de paneles que pueden existir al mismo tiempo
 #ifndef MAXIMO_PANELES
 #define MAXIMO_PANELES 3
 #endif
 
 //! @brief Cantidad máxima de digitos que se pueden mostrar en un panel
 #ifndef MAXIMO_DIGITOS
-#define MAXIMO_DIGITOS 4
+#define MAXIMO_DIGITOS 6
 #endif
 
+#define SEGMENTOS_RECTANGULARES 0x00 //!< Forma de los segmentos rectangulares
+#define SEGMENTOS_BISELADOS     0x01 //!< Forma de los segmentos con los extremos en punta
+#define SEGMENTOS_INCLINADOS    0x02 //!< Forma de los digitos inclinados hacia la derecha
+
+#define SEPARADOR_NINGUNO    0 //!< Digito sin separador a su derecha
+#define SEPARADOR_DOS_PUNTOS 1 //!< Separador de dos puntos, como entre horas y minutos
+#define SEPARADOR_PUNTO      2 //!< Separador de punto decimal
+#define SEPARADOR_APOSTROFE  3 //!< Separador de apóstrofe
+
+#define ANIMACION_NINGUNA 0 //!< Los digitos cambian de una vez
+#define ANIMACION_RODAR   1 //!< El digito anterior sale por arriba mientras el nuevo entra por abajo
+#define ANIMACION_FUNDIR  2 //!< Los segmentos que cambian pasan de un color al otro en forma gradual
+
+//! @brief Cantidad máxima de segmentos y puntos que se juntan entre @ref AgruparCambios y @ref ConfirmarCambios
+#ifndef MAXIMO_CAMBIOS
+#define MAXIMO_CAMBIOS 64
+#endif
+
+/**
+ * @brief Cantidad de paneles que pueden calcular su geometría al crearse
+ *
+ * Cada panel creado con @ref CrearPanel o @ref CrearPanelAlfanumerico ocupa una geometría de esta reserva hasta que se
+ * destruye. Una aplicación que crea todos sus paneles con @ref CrearPanelGeometria puede definirla en 0 para no
+ * reservar esa memoria, agregando en main/CMakeLists.txt:
+ *
+ *     target_compile_definitions(${COMPONENT_LIB} PRIVATE GEOMETRIAS_CALCULADAS=0)
+ *
+ * Con 0 las funciones que calculan la geometría no pueden crear paneles, lo informan en el registro y fallan con un
+ * assert cuando está habilitado.
+ */
+#ifndef GEOMETRIAS_CALCULADAS
+#define GEOMETRIAS_CALCULADAS MAXIMO_PANELES
+#endif
+
+/**
+ * @brief Macros para calcular la geometría de un digito
+ *
+ * Son expresiones constantes cuando el alto y el ancho lo son, así que las mismas cuentas sirven para guardar la
+ * geometría de un panel de tamaño fijo como datos constantes en la memoria de programa con @ref GEOMETRIA_DIGITO y
+ * para calcularla al crear un panel con @ref CrearPanel. Un ancho de 0 usa el 60% del alto.
+ */
+#define GEOMETRIA_ANCHO(alto, ancho)   ((ancho) ? (ancho) : ((alto) * 60) / 100)
+#define GEOMETRIA_BARRA(alto)          (((alto) * 7) / 100)
+#define GEOMETRIA_MARGEN(alto)         ((GEOMETRIA_BARRA(alto) * 75) / 100)
+#define GEOMETRIA_SEPARACION(alto)     (((alto) * 2) / 100)
+#define GEOMETRIA_INTERIOR(alto)       (GEOMETRIA_MARGEN(alto) + GEOMETRIA_BARRA(alto))
+#define GEOMETRIA_IZQUIERDA(alto)      (GEOMETRIA_INTERIOR(alto) + GEOMETRIA_SEPARACION(alto))
+#define GEOMETRIA_DERECHA(alto, ancho) (GEOMETRIA_ANCHO(alto, ancho) - GEOMETRIA_IZQUIERDA(alto))
+#define GEOMETRIA_CENTRO(alto, ancho)  ((GEOMETRIA_ANCHO(alto, ancho) - GEOMETRIA_BARRA(alto)) / 2)
+#define GEOMETRIA_CORTE(alto, ancho)   (GEOMETRIA_CENTRO(alto, ancho) - GEOMETRIA_SEPARACION(alto))
+#define GEOMETRIA_CENTRAL(alto, ancho)                                                                                 \
+    (GEOMETRIA_CENTRO(alto, ancho) + GEOMETRIA_BARRA(alto) + GEOMETRIA_SEPARACION(alto))
+#define GEOMETRIA_SUPERIOR(alto)       (((alto) - GEOMETRIA_SEPARACION(alto)) / 2)
+#define GEOMETRIA_INFERIOR(alto)       (((alto) + GEOMETRIA_SEPARACION(alto)) / 2)
+#define GEOMETRIA_MEDIO_ARRIBA(alto)   (((alto) - GEOMETRIA_BARRA(alto)) / 2)
+#define GEOMETRIA_MEDIO_ABAJO(alto)    (((alto) + GEOMETRIA_BARRA(alto)) / 2)
+#define GEOMETRIA_PISO(alto)           ((alto) - GEOMETRIA_INTERIOR(alto))
+#define GEOMETRIA_BASE(alto)           ((alto) - GEOMETRIA_MARGEN(alto))
+#define GEOMETRIA_AREA(x1, y1, x2, y2) {{(x1), (y1)}, {(x2), (y2)}}
+
+/**
+ * @brief Macro con el inicializador de la geometría de un panel de 7 o 14 segmentos
+ *
+ * Los segmentos van de A a M en el orden de bits de las máscaras. Con 14 segmentos el segmento G se divide en dos y se
+ * agregan una vertical central y cuatro diagonales. Los separadores son cuadrados del ancho de un segmento, centrados
+ * en una columna de tres segmentos de ancho.
+ */
+#define GEOMETRIA_PANEL(alto, ancho, cantidad)                                                                         \
+    {                                                                                                                  \
+        (alto),                                                                                                        \
+        GEOMETRIA_ANCHO(alto, ancho),                                                                                  \
+        (cantidad),                                                                                                    \
+        3 * GEOMETRIA_BARRA(alto),                                                                                     \
+        {                                                                                                              \
+            GEOMETRIA_AREA(GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_MARGEN(alto), GEOMETRIA_DERECHA(alto, ancho),          \
+                           GEOMETRIA_INTERIOR(alto)),                                                                  \
+            GEOMETRIA_AREA(GEOMETRIA_ANCHO(alto, ancho) - GEOMETRIA_MARGEN(alto), GEOMETRIA_MARGEN(alto),              \
+                           GEOMETRIA_ANCHO(alto, ancho) - GEOMETRIA_INTERIOR(alto), GEOMETRIA_SUPERIOR(alto)),         \
+            GEOMETRIA_AREA(GEOMETRIA_ANCHO(alto, ancho) - GEOMETRIA_MARGEN(alto), GEOMETRIA_INFERIOR(alto),            \
+                           GEOMETRIA_ANCHO(alto, ancho) - GEOMETRIA_INTERIOR(alto), GEOMETRIA_BASE(alto)),             \
+            GEOMETRIA_AREA(GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_PISO(alto), GEOMETRIA_DERECHA(alto, ancho),            \
+                           GEOMETRIA_BASE(alto)),                                                                      \
+            GEOMETRIA_AREA(GEOMETRIA_MARGEN(alto), GEOMETRIA_INFERIOR(alto), GEOMETRIA_INTERIOR(alto),                 \
+                           GEOMETRIA_BASE(alto)),                                                                      \
+            GEOMETRIA_AREA(GEOMETRIA_MARGEN(alto), GEOMETRIA_MARGEN(alto), GEOMETRIA_INTERIOR(alto),                   \
+                           GEOMETRIA_SUPERIOR(alto)),                                                                  \
+            GEOMETRIA_AREA(GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_MEDIO_ARRIBA(alto),                                    \
+                           (cantidad) > 7 ? GEOMETRIA_CORTE(alto, ancho) : GEOMETRIA_DERECHA(alto, ancho),             \
+                           GEOMETRIA_MEDIO_ABAJO(alto)),                                                               \
+            GEOMETRIA_AREA(GEOMETRIA_CENTRAL(alto, ancho), GEOMETRIA_MEDIO_ARRIBA(alto),                               \
+                           GEOMETRIA_DERECHA(alto, ancho), GEOMETRIA_MEDIO_ABAJO(alto)),                               \
+            GEOMETRIA_AREA(GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_CORTE(alto, ancho),         \
+                           GEOMETRIA_MEDIO_ARRIBA(alto) - GEOMETRIA_SEPARACION(alto)),                                 \
+            GEOMETRIA_AREA(GEOMETRIA_CENTRO(alto, ancho), GEOMETRIA_IZQUIERDA(alto),                                   \
+                           GEOMETRIA_CENTRO(alto, ancho) + GEOMETRIA_BARRA(alto),                                      \
+                           GEOMETRIA_MEDIO_ARRIBA(alto) - GEOMETRIA_SEPARACION(alto)),                                 \
+            GEOMETRIA_AREA(GEOMETRIA_CENTRAL(alto, ancho), GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_DERECHA(alto, ancho),  \
+                           GEOMETRIA_MEDIO_ARRIBA(alto) - GEOMETRIA_SEPARACION(alto)),                                 \
+            GEOMETRIA_AREA(GEOMETRIA_IZQUIERDA(alto), GEOMETRIA_MEDIO_ABAJO(alto) + GEOMETRIA_SEPARACION(alto),        \
+                           GEOMETRIA_CORTE(alto, ancho), GEOMETRIA_PISO(alto) - GEOMETRIA_SEPARACION(alto)),           \
+            GEOMETRIA_AREA(GEOMETRIA_CENTRO(alto, ancho), GEOMETRIA_MEDIO_ABAJO(alto) + GEOMETRIA_SEPARACION(alto),    \
+                           GEOMETRIA_CENTRO(alto, ancho) + GEOMETRIA_BARRA(alto),                                      \
+                           GEOMETRIA_PISO(alto) - GEOMETRIA_SEPARACION(alto)),                                         \
+            GEOMETRIA_AREA(GEOMETRIA_CENTRAL(alto, ancho), GEOMETRIA_MEDIO_ABAJO(alto) + GEOMETRIA_SEPARACION(alto),   \
+                           GEOMETRIA_DERECHA(alto, ancho), GEOMETRIA_PISO(alto) - GEOMETRIA_SEPARACION(alto)),         \
+        },                                                                                                             \
+        {                                                                                                              \
+            GEOMETRIA_AREA(GEOMETRIA_BARRA(alto), (alto) / 3 - GEOMETRIA_BARRA(alto) / 2, 2 * GEOMETRIA_BARRA(alto),   \
+                           (alto) / 3 - GEOMETRIA_BARRA(alto) / 2 + GEOMETRIA_BARRA(alto)),                            \
+            GEOMETRIA_AREA(GEOMETRIA_BARRA(alto), (2 * (alto)) / 3 - GEOMETRIA_BARRA(alto) / 2,                        \
+                           2 * GEOMETRIA_BARRA(alto),                                                                  \
+                           (2 * (alto)) / 3 - GEOMETRIA_BARRA(alto) / 2 + GEOMETRIA_BARRA(alto)),                      \
+            GEOMETRIA_AREA(GEOMETRIA_BARRA(alto), GEOMETRIA_PISO(alto), 2 * GEOMETRIA_BARRA(alto),                     \
+                           GEOMETRIA_BASE(alto)),                                                                      \
+            GEOMETRIA_AREA(GEOMETRIA_BARRA(alto), GEOMETRIA_MARGEN(alto), 2 * GEOMETRIA_BARRA(alto),                   \
+                           GEOMETRIA_MARGEN(alto) + 2 * GEOMETRIA_BARRA(alto)),                                        \
+        },                                                                                                             \
+    }
+
+//! @brief Inicializador de la geometría constante de un panel de digitos de 7 segmentos
+#define GEOMETRIA_DIGITO(alto, ancho) GEOMETRIA_PANEL(alto, ancho, 7)
+
+//! @brief Inicializador de la geometría constante de un panel alfanumérico de 14 segmentos
+#define GEOMETRIA_ALFANUMERICA(alto, ancho) GEOMETRIA_PANEL(alto, ancho, 14)
+
 /* === Public data type declarations =============================================================================== */
 
 //! @brief Tipo de dato para referenciar a un panel de digitos
 typedef struct panel_s * panel_t;
 
+//! @brief Punto relativo a la esquina superior izquierda de un digito
+struct punto_s {
+    uint16_t x;
+    uint16_t y;
+};
+
+//! @brief Rectángulo con sus esquinas superior izquierda e inferior derecha
+struct area_s {
+    struct punto_s desde;
+    struct punto_s hasta;
+};
+
+//! @brief Geometría de los digitos de un panel, en el orden de bits de las máscaras de segmentos
+typedef struct panel_geometria_s {
+    uint16_t alto;               //!< Alto en pixeles del digito
+    uint16_t ancho;              //!< Ancho en pixeles del digito
+    uint8_t cantidad;            //!< Cantidad de segmentos de cada digito, 7 o 14
+    uint16_t ancho_separador;    //!< Ancho en pixeles de la columna de un separador
+    struct area_s segmentos[14]; //!< Rectángulos de los segmentos, de A a M
+    struct area_s marcas[4];     //!< Rectángulos de los puntos de los separadores
+} panel_geometria_t;
+
+//! @brief Contadores de actualizaciones de un panel
+typedef struct panel_estadisticas_s {
+    uint32_t actualizaciones; //!< Digitos que cambiaron y se redibujaron
+    uint32_t omitidas;        //!< Digitos que no cambiaron y no enviaron nada a la pantalla
+    uint32_t segmentos;       //!< Segmentos redibujados
+} panel_estadisticas_t;
+
+//! @brief Contadores de los cuadros de animación de todos los paneles
+typedef struct animacion_estadisticas_s {
+    uint32_t cuadros;         //!< Cuadros de animación procesados
+    uint32_t pasos;           //!< Pasos de animación enviados a la pantalla
+    uint32_t saltados;        //!< Pasos que no entraron en el presupuesto de su cuadro y no se dibujaron
+    uint32_t bytes;           //!< Bytes de pixeles enviados en el último cuadro
+    uint32_t bytes_maximo;    //!< Máximo de bytes de pixeles enviados en un cuadro
+    uint32_t duracion;        //!< Duración en microsegundos del último cuadro
+    uint32_t duracion_maxima; //!< Duración máxima en microsegundos de un cuadro
+} animacion_estadisticas_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -66,20 +232,233 @@ typedef struct panel_s * panel_t;
  * @param  encendido Color de los segmentos encendidos de los digitos
  * @param  apagado   Color de los segmentos apagados de los digitos
  * @param  fondo     Color de fondo del panel
- * @return panel_t   Puntero al panel creado
+ * @return panel_t   Puntero al panel creado, NULL si no quedan paneles o geometrías libres
  */
 panel_t CrearPanel(uint16_t x, uint16_t y, uint16_t digitos, uint16_t alto, uint16_t ancho, uint16_t encendido,
                    uint16_t apagado, uint16_t fondo);
 
+/**
+ * @brief Función que crea un panel de n caracteres alfanuméricos de 14 segmentos en una pantalla TFT
+ *
+ * Los paneles alfanuméricos usan la misma geometría que los de 7 segmentos, con el segmento central dividido en dos,
+ * una vertical central y cuatro diagonales. Muestran digitos, letras de la A a la Z sin distinguir mayúsculas y
+ * algunos signos.
+ *
+ * @param  x          Posición horizontal de la esquina superior derecha del panel
+ * @param  y          Posición vertical de la esquina superior derecha del panel
+ * @param  caracteres Cantidad de caracteres que se pueden mostrar en el panel
+ * @param  alto       Alto en pixeles del caracter del panel
+ * @param  ancho      Ancho en pixeles del caracter del panel
+ * @param  encendido  Color de los segmentos encendidos de los caracteres
+ * @param  apagado    Color de los segmentos apagados de los caracteres
+ * @param  fondo      Color de fondo del panel
+ * @return panel_t    Puntero al panel creado, NULL si no quedan paneles o geometrías libres
+ */
+panel_t CrearPanelAlfanumerico(uint16_t x, uint16_t y, uint16_t caracteres, uint16_t alto, uint16_t ancho,
+                               uint16_t encendido, uint16_t apagado, uint16_t fondo);
+
+/**
+ * @brief Función que crea un panel a partir de una geometría constante
+ *
+ * La geometría se define en tiempo de compilación con @ref GEOMETRIA_DIGITO o @ref GEOMETRIA_ALFANUMERICA, queda en la
+ * memoria de programa y puede compartirse entre varios paneles del mismo tamaño. El panel no copia la geometría, así
+ * que debe existir mientras exista el panel.
+ *
+ * @param  x         Posición horizontal de la esquina superior derecha del panel
+ * @param  y         Posición vertical de la esquina superior derecha del panel
+ * @param  digitos   Cantidad de digitos que se pueden mostrar en el panel
+ * @param  geometria Geometría de los digitos del panel
+ * @param  encendido Color de los segmentos encendidos de los digitos
+ * @param  apagado   Color de los segmentos apagados de los digitos
+ * @param  fondo     Color de fondo del panel
+ * @return panel_t   Puntero al panel creado, NULL si no quedan paneles libres o el digito es más ancho que la pantalla
+ */
+panel_t CrearPanelGeometria(uint16_t x, uint16_t y, uint16_t digitos, const panel_geometria_t * geometria,
+                            uint16_t encendido, uint16_t apagado, uint16_t fondo);
+
+/**
+ * @brief Función que libera un panel para que pueda ser reutilizado por @ref CrearPanel
+ *
+ * El contenido del panel queda en la pantalla, el panel no puede usarse después de liberado.
+ *
+ * @param self       Puntero al panel creado con la funcion @ref CrearPanel
+ */
+void DestruirPanel(panel_t self);
+
 /**
  * @brief Función para actualizar el valor de un digito en un panel
  *
+ * El panel recuerda los segmentos encendidos de cada digito en la pantalla, solo se redibujan los segmentos que
+ * cambian de estado y no se envía nada si el digito no cambia.
+ *
  * @param self       Puntero al panel creado con la funcion @ref CrearPanel
  * @param posicion   Posición del digito que se desea actualizar
- * @param valor      Valor que se desea mostrar en el digito
+ * @param valor      Valor que se desea mostrar en el digito, los valores mayores a 15 apagan el digito
  */
 void DibujarDigito(panel_t self, uint8_t posicion, uint8_t valor);
 
+/**
+ * @brief Función para actualizar un caracter en un panel
+ *
+ * En un panel de 7 segmentos solo se muestran los digitos hexadecimales, el resto de los caracteres apaga el digito.
+ *
+ * @param self       Puntero al panel creado con la funcion @ref CrearPanel o @ref CrearPanelAlfanumerico
+ * @param posicion   Posición del caracter que se desea actualizar
+ * @param caracter   Caracter que se desea mostrar, los que no tienen representación apagan el digito
+ */
+void DibujarCaracter(panel_t self, uint8_t posicion, char caracter);
+
+/**
+ * @brief Función para mostrar un número completo en un panel
+ *
+ * Calcula todos los digitos del número y redibuja solo los que cambian, enviándolos en una sola sesión del bus. Si el
+ * número no entra en el panel se muestran sus digitos menos significativos.
+ *
+ * @param self       Puntero al panel creado con la funcion @ref CrearPanel
+ * @param valor      Número que se desea mostrar
+ * @param base       Base en la que se muestra el número, entre 2 y 16
+ * @param ceros      Indica si se muestran los ceros a la izquierda o se apagan esos digitos
+ */
+void PanelMostrarNumero(panel_t self, uint32_t valor, uint8_t base, bool ceros);
+
+/**
+ * @brief Función para mostrar un texto completo en un panel
+ *
+ * Igual que @ref PanelMostrarNumero redibuja solo los caracteres que cambian en una sola sesión del bus. Los
+ * caracteres que no entran en el panel se ignoran y las posiciones que sobran se apagan.
+ *
+ * @param self       Puntero al panel creado con la funcion @ref CrearPanel o @ref CrearPanelAlfanumerico
+ * @param texto      Texto que se desea mostrar
+ */
+void PanelMostrarTexto(panel_t self, const char * texto);
+
+/**
+ * @brief Función para cambiar la forma de los segmentos de un panel
+ *
+ * Las formas se pueden combinar. Cada fila de un segmento con forma se guarda como un tramo en una tabla que se calcula
+ * una sola vez, y cada segmento se envía como una ventana con su rectángulo, así que la forma no agrega transferencias
+ * respecto a los segmentos rectangulares. El panel se redibuja completo con la nueva forma.
+ *
+ * La tabla ocupa dos bytes por cada fila de cada segmento, más la ventana y la posición de los tramos de cada
+ * segmento, y la memoria la entrega quien llama, así que los paneles rectangulares no la necesitan. Un digito de 60
+ * pixeles de alto usa unos 320 bytes y uno de 100 unos 480.
+ *
+ * @param  self    Puntero al panel creado con la funcion @ref CrearPanel
+ * @param  forma   Combinación de @ref SEGMENTOS_BISELADOS y @ref SEGMENTOS_INCLINADOS, o @ref SEGMENTOS_RECTANGULARES
+ * @param  memoria Buffer para la tabla de tramos, debe existir mientras el panel tenga forma, puede ser NULL si la
+ *                 forma es rectangular
+ * @param  bytes   Tamaño del buffer en bytes
+ * @return true    El panel usa la forma pedida
+ * @return false   La tabla no entra en el buffer, el panel usa segmentos rectangulares
+ */
+bool PanelFormaSegmentos(panel_t self, uint8_t forma, int8_t * memoria, uint16_t bytes);
+
+/**
+ * @brief Función para agregar un separador a la derecha de un digito de un panel
+ *
+ * El separador ocupa una columna propia, así que los digitos que le siguen se corren a la derecha. El panel se
+ * redibuja completo, por lo que conviene agregar los separadores justo después de crear el panel.
+ *
+ * @param self       Puntero al panel creado con la funcion @ref CrearPanel
+ * @param posicion   Posición del digito a cuya derecha se agrega el separador
+ * @param tipo       Tipo de separador, @ref SEPARADOR_NINGUNO lo quita
+ */
+void PanelSeparador(panel_t self, uint8_t posicion, uint8_t tipo);
+
+/**
+ * @brief Función para encender o apagar un separador de un panel
+ *
+ * Los separadores usan los mismos colores que los segmentos y, igual que ellos, solo se redibujan cuando cambian.
+ *
+ * @param self       Puntero al panel creado con la funcion @ref CrearPanel
+ * @param posicion   Posición del digito a cuya derecha está el separador
+ * @param encendido  Indica si el separador se muestra encendido o apagado
+ */
+void PanelEncenderSeparador(panel_t self, uint8_t posicion, bool encendido);
+
+/**
+ * @brief Función para leer los contadores de actualizaciones de un panel
+ *
+ * @param self         Puntero al panel creado con la funcion @ref CrearPanel
+ * @param estadisticas Contadores del panel desde su creación
+ */
+void PanelEstadisticas(panel_t self, panel_estadisticas_t * estadisticas);
+
+/**
+ * @brief Función para dibujar los digitos de un panel a partir de imagenes pre-dibujadas
+ *
+ * La geometría de un panel no cambia, así que cada valor se dibuja una sola vez en una imagen comprimida por franjas
+ * de filas iguales y tramos de un mismo color. Con las imagenes habilitadas cada digito que cambia se envía con una
+ * sola ventana y una transferencia por DMA, en lugar de rellenar los segmentos que cambian uno por uno. Las imagenes
+ * guardan el estado de cada pixel y no su color, así que ocupan lo mismo con cualquier combinación de colores.
+ *
+ * La memoria de las imagenes la entrega quien llama, así que solo la ocupan los paneles que las usan. Un digito de 60
+ * pixeles de alto con segmentos rectangulares ocupa unos 550 bytes y uno de 100 unos 900, los segmentos con forma
+ * tienen pocas filas iguales y ocupan varias veces más. Un buffer que no alcanza deja al panel con segmentos.
+ *
+ * @param  self    Puntero al panel creado con la funcion @ref CrearPanel
+ * @param  memoria Buffer para las imagenes, debe existir mientras el panel las use, NULL deja de usarlas
+ * @param  bytes   Tamaño del buffer en bytes
+ * @return true    El panel usa las imagenes pre-dibujadas
+ * @return false   Las imagenes no entran en el buffer, no se habilitaron o el panel es alfanumérico, el panel
+ *                 dibuja segmentos
+ */
+bool PanelPredibujarDigitos(panel_t self, uint8_t * memoria, uint16_t bytes);
+
+/**
+ * @brief Función para animar los cambios de los digitos de un panel
+ *
+ * Con la animación habilitada los digitos que cambian no se dibujan de inmediato, la transición avanza un paso en cada
+ * llamada a @ref AnimarPaneles. Al deshabilitarla las transiciones en curso terminan y el panel se redibuja completo.
+ *
+ * @param  self  Puntero al panel creado con la funcion @ref CrearPanel
+ * @param  tipo  Tipo de animación, @ref ANIMACION_NINGUNA la deshabilita
+ * @param  pasos Cantidad de cuadros que dura cada transición
+ * @return true  El panel usa la animación pedida
+ * @return false El tipo de animación no existe, el panel cambia sus digitos de una vez
+ */
+bool PanelAnimacion(panel_t self, uint8_t tipo, uint8_t pasos);
+
+/**
+ * @brief Función para dibujar un cuadro de las transiciones en curso de todos los paneles
+ *
+ * De cada digito que cambia se envían solo las filas o los segmentos que son distintos al paso anterior. Los pasos que
+ * no entran en el presupuesto del cuadro se saltean, y como las transiciones avanzan igual en cada cuadro, el digito se
+ * pone al día en el siguiente paso que se dibuja. Para que una transición nunca quede detenida el primer paso de cada
+ * cuadro se envía aunque supere el presupuesto. Los paneles sin animación no pasan por esta función, así que sus
+ * digitos nunca esperan a las animaciones.
+ *
+ * @param  presupuesto Cantidad máxima de bytes de pixeles que se pueden enviar en el cuadro
+ * @return true        Quedan transiciones en curso
+ * @return false       No hay transiciones en curso
+ */
+bool AnimarPaneles(uint32_t presupuesto);
+
+/**
+ * @brief Función para leer los contadores de los cuadros de animación
+ *
+ * @param estadisticas Contadores de todos los cuadros procesados por @ref AnimarPaneles
+ */
+void EstadisticasAnimacion(animacion_estadisticas_t * estadisticas);
+
+/**
+ * @brief Función para empezar a juntar los cambios de todos los paneles y enviarlos juntos
+ *
+ * Hasta la llamada a @ref ConfirmarCambios los segmentos, digitos pre-dibujados y puntos de los separadores que cambian
+ * no se envían, se anotan con el rectángulo de la pantalla que ocupan. Las llamadas se pueden anidar, los cambios se
+ * envían al confirmar el grupo más externo. Si se juntan más de @ref MAXIMO_CAMBIOS los anotados se envían antes.
+ */
+void AgruparCambios(void);
+
+/**
+ * @brief Función para enviar los cambios juntados desde la llamada a @ref AgruparCambios
+ *
+ * Los cambios se ordenan por su posición en la pantalla, de arriba hacia abajo y de izquierda a derecha, así los que
+ * comparten filas reusan la ventana enviada antes y los rectángulos vecinos del mismo color se envían como uno solo.
+ * Todos se dibujan con el estado que tienen los paneles al confirmar y en una sola sesión del bus.
+ */
+void ConfirmarCambios(void);
+
 /* === End of documentation ======================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,241 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file etiquetas.c
+ ** @brief Definiciones de la biblioteca para mostrar etiquetas de texto que solo redibujan los caracteres que cambian
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "etiquetas.h"
+#include "ili9341.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Indica si un byte de un texto UTF-8 continúa un caracter en lugar de comenzarlo
+#define CONTINUACION(byte) (((uint8_t)(byte) & 0xC0) == 0x80)
+
+/* === Private data type declarations ============================================================================== */
+
+struct etiqueta_s {
+    uint16_t x;
+    uint16_t y;
+    Font_t * fuente;
+    uint16_t frente;
+    uint16_t fondo;
+    uint8_t largo;
+    char texto[MAXIMO_CARACTERES + 1];
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que obtiene una etiqueta libre
+ *
+ * @return etiqueta_t Puntero a la etiqueta, NULL si no quedan etiquetas disponibles
+ */
+static etiqueta_t CrearInstancia(void);
+
+/**
+ * @brief Función que calcula el ancho en pixeles de los primeros bytes de un texto
+ *
+ * @param  self     Puntero a la etiqueta
+ * @param  texto    Texto a medir
+ * @param  largo    Cantidad de bytes a medir
+ * @return uint16_t Ancho en pixeles
+ */
+static uint16_t AnchoTexto(etiqueta_t self, const char * texto, uint8_t largo);
+
+/**
+ * @brief Función que calcula la posición en pixeles de un caracter dentro de un texto
+ *
+ * @param  self     Puntero a la etiqueta
+ * @param  texto    Texto completo
+ * @param  desde    Posición del primer byte del caracter
+ * @return uint16_t Distancia desde el comienzo del texto, incluyendo el kerning con el caracter anterior
+ */
+static uint16_t PosicionCaracter(etiqueta_t self, const char * texto, uint8_t desde);
+
+/**
+ * @brief Función que dibuja una parte del texto de la etiqueta en su posición
+ *
+ * @param self  Puntero a la etiqueta
+ * @param texto Texto de la etiqueta
+ * @param desde Posición del primer byte a dibujar, debe comenzar un caracter
+ * @param hasta Posición siguiente al último byte a dibujar, debe comenzar un caracter o terminar el texto
+ */
+static void DibujarTramo(etiqueta_t self, const char * texto, uint8_t desde, uint8_t hasta);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static etiqueta_t CrearInstancia(void) {
+    static struct etiqueta_s instancias[MAXIMO_ETIQUETAS];
+
+    for (int indice = 0; indice < MAXIMO_ETIQUETAS; indice++) {
+        if (instancias[indice].fuente == NULL) {
+            return &(instancias[indice]);
+        }
+    }
+    return NULL;
+}
+
+static uint16_t AnchoTexto(etiqueta_t self, const char * texto, uint8_t largo) {
+    char parte[MAXIMO_CARACTERES + 1];
+    uint16_t ancho, alto;
+
+    memcpy(parte, texto, largo);
+    parte[largo] = '\0';
+    ILI9341GetStringSize(parte, self->fuente, &ancho, &alto);
+    return ancho;
+}
+
+static uint16_t PosicionCaracter(etiqueta_t self, const char * texto, uint8_t desde) {
+    uint8_t hasta;
+
+    if ((desde == 0) || (self->fuente->kerning_count == 0) || (texto[desde] == '\0')) {
+        return AnchoTexto(self, texto, desde);
+    }
+    /* El ancho del texto hasta el caracter no incluye el kerning con el anterior, que sí suma el texto que lo
+     * contiene. La posición es ese ancho menos el avance del caracter solo */
+    for (hasta = desde + 1; CONTINUACION(texto[hasta]); hasta++) {
+    }
+    return AnchoTexto(self, texto, hasta) - AnchoTexto(self, &texto[desde], hasta - desde);
+}
+
+static void DibujarTramo(etiqueta_t self, const char * texto, uint8_t desde, uint8_t hasta) {
+    char parte[MAXIMO_CARACTERES + 1];
+
+    memcpy(parte, &texto[desde], hasta - desde);
+    parte[hasta - desde] = '\0';
+    ILI9341DrawString(self->x + PosicionCaracter(self, texto, desde), self->y, parte, self->fuente, self->frente,
+                      self->fondo);
+}
+
+/* === Public function implementation ============================================================================== */
+
+etiqueta_t CrearEtiqueta(uint16_t x, uint16_t y, Font_t * fuente, uint16_t frente, uint16_t fondo) {
+    etiqueta_t self = CrearInstancia();
+    if (self) {
+        self->x = x;
+        self->y = y;
+        self->fuente = fuente;
+        self->frente = frente;
+        self->fondo = fondo;
+        self->largo = 0;
+        self->texto[0] = '\0';
+    }
+    return self;
+}
+
+void EscribirEtiqueta(etiqueta_t self, const char * texto) {
+    uint8_t largo, comun, sufijo, desde;
+    uint16_t anterior, actual;
+
+    for (largo = 0; (largo < MAXIMO_CARACTERES) && (texto[largo] != '\0'); largo++) {
+    }
+    /* Un caracter UTF-8 cortado por el límite de la etiqueta se descarta completo */
+    while ((largo > 0) && (texto[largo] != '\0') && CONTINUACION(texto[largo])) {
+        largo--;
+    }
+
+    /* Caracteres iguales al principio y al final del texto */
+    for (comun = 0; (comun < largo) && (comun < self->largo) && (texto[comun] == self->texto[comun]); comun++) {
+    }
+    if ((comun == largo) && (largo == self->largo)) {
+        return;
+    }
+    for (sufijo = 0; (sufijo < largo - comun) && (sufijo < self->largo - comun) &&
+                     (texto[largo - sufijo - 1] == self->texto[self->largo - sufijo - 1]);
+         sufijo++) {
+    }
+
+    /* El interletrado de una fuente con kerning depende también del caracter siguiente */
+    if (self->fuente->kerning_count > 0) {
+        comun = (comun > 0) ? comun - 1 : 0;
+        sufijo = (sufijo > 0) ? sufijo - 1 : 0;
+    }
+    /* Los tramos a dibujar comienzan y terminan en caracteres completos */
+    while ((comun > 0) && CONTINUACION(texto[comun])) {
+        comun--;
+    }
+    while ((sufijo > 0) && CONTINUACION(texto[largo - sufijo])) {
+        sufijo--;
+    }
+
+    anterior = AnchoTexto(self, self->texto, self->largo);
+    actual = AnchoTexto(self, texto, largo);
+    if ((anterior == actual) && (largo == self->largo) && (self->fuente->glyphs == NULL)) {
+        /* Con ancho fijo cada caracter ocupa siempre la misma celda, se dibuja cada grupo de caracteres distintos */
+        for (uint8_t indice = comun; indice < largo - sufijo;) {
+            if (texto[indice] == self->texto[indice]) {
+                indice++;
+                continue;
+            }
+            for (desde = indice; (indice < largo - sufijo) && (texto[indice] != self->texto[indice]); indice++) {
+            }
+            while ((desde > 0) && CONTINUACION(texto[desde])) {
+                desde--;
+            }
+            while ((indice < largo) && CONTINUACION(texto[indice])) {
+                indice++;
+            }
+            if (AnchoTexto(self, texto, desde) != AnchoTexto(self, self->texto, desde)) {
+                /* Un caracter de otro largo en bytes movió el resto del texto */
+                DibujarTramo(self, texto, desde, largo - sufijo);
+                break;
+            }
+            DibujarTramo(self, texto, desde, indice);
+        }
+    } else if (anterior == actual) {
+        /* Los caracteres del final no se mueven si el ancho total no cambia */
+        DibujarTramo(self, texto, comun, largo - sufijo);
+    } else {
+        if (comun < largo) {
+            DibujarTramo(self, texto, comun, largo);
+        }
+        if (anterior > actual) {
+            ILI9341DrawFilledRectangle(self->x + actual, self->y, self->x + anterior - 1,
+                                       self->y + self->fuente->FontHeight - 1, self->fondo);
+        }
+    }
+
+    memcpy(self->texto, texto, largo);
+    self->texto[largo] = '\0';
+    self->largo = largo;
+}
+
+void ColorearEtiqueta(etiqueta_t self, uint16_t frente, uint16_t fondo) {
+    if ((self->frente != frente) || (self->fondo != fondo)) {
+        self->frente = frente;
+        self->fondo = fondo;
+        if (self->largo > 0) {
+            DibujarTramo(self, self->texto, 0, self->largo);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,98 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef ETIQUETAS_H_
+#define ETIQUETAS_H_
+
+/** @file etiquetas.h
+ ** @brief Declaraciones de la biblioteca para mostrar etiquetas de texto que solo redibujan los caracteres que cambian
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "fonts.h"
+#include <stdint.h>
+
+/* === Cabecera C++ ================================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! @brief Cantidad máxima de etiquetas que se pueden crear
+#ifndef MAXIMO_ETIQUETAS
+#define MAXIMO_ETIQUETAS 4
+#endif
+
+//! @brief Cantidad máxima de caracteres que se pueden mostrar en una etiqueta
+#ifndef MAXIMO_CARACTERES
+#define MAXIMO_CARACTERES 24
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! @brief Tipo de dato para referenciar a una etiqueta de texto
+typedef struct etiqueta_s * etiqueta_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función que crea una etiqueta de texto vacía en una pantalla TFT
+ *
+ * @param  x          Posición horizontal de la esquina superior izquierda de la etiqueta
+ * @param  y          Posición vertical de la esquina superior izquierda de la etiqueta
+ * @param  fuente     Fuente con la que se dibuja el texto de la etiqueta
+ * @param  frente     Color del texto
+ * @param  fondo      Color de fondo del texto
+ * @return etiqueta_t Puntero a la etiqueta creada, NULL si no quedan etiquetas disponibles
+ */
+etiqueta_t CrearEtiqueta(uint16_t x, uint16_t y, Font_t * fuente, uint16_t frente, uint16_t fondo);
+
+/**
+ * @brief Función para cambiar el texto de una etiqueta
+ *
+ * Solo se redibujan los caracteres distintos a los que ya se muestran, y no se envía nada a la pantalla si el texto
+ * no cambió. Con fuentes proporcionales se redibuja desde el primer caracter distinto, salvo que el ancho total del
+ * texto no cambie. Los caracteres después de @ref MAXIMO_CARACTERES se ignoran.
+ *
+ * @param self  Puntero a la etiqueta creada con la funcion @ref CrearEtiqueta
+ * @param texto Texto de una sola linea que se desea mostrar
+ */
+void EscribirEtiqueta(etiqueta_t self, const char * texto);
+
+/**
+ * @brief Función para cambiar los colores de una etiqueta, si cambian se redibuja todo el texto
+ *
+ * @param self   Puntero a la etiqueta creada con la funcion @ref CrearEtiqueta
+ * @param frente Color del texto
+ * @param fondo  Color de fondo del texto
+ */
+void ColorearEtiqueta(etiqueta_t self, uint16_t frente, uint16_t fondo);
+
+/* === End of documentation ======================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ETIQUETAS_H_ */
@@ -636,21 +636,48 @@ Font_t font_7x10 =
 {
 	7,
 	10,
-	font7x10_data
+	font7x10_data,
+	NULL,
+	NULL,
+	0,
+	0,
+	NULL,
+	0,
+	0,
+	NULL,
+	0
 };
 
 Font_t font_11x18 =
 {
 	11,
 	18,
-	font11x18_data
+	font11x18_data,
+	NULL,
+	NULL,
+	0,
+	0,
+	NULL,
+	0,
+	0,
+	NULL,
+	0
 };
 
 Font_t font_16x26 =
 {
 	16,
 	26,
-	font16x26_data
+	font16x26_data,
+	NULL,
+	NULL,
+	0,
+	0,
+	NULL,
+	0,
+	0,
+	NULL,
+	0
 };
 
 /*****************************************************************************
@@ -6,6 +6,12 @@
  *  - 11 x 18 pixels
  *  - 16 x 26 pixels
  *
+ * @note Fonts may also use the generalized format: bit-packed rows of any width,
+ * a bounding box and advance for each glyph and optional kerning pairs. Glyphs
+ * may be 1 bit per pixel or anti-aliased with 2 or 4 bits of coverage per pixel.
+ * Characters are Unicode code points of the basic multilingual plane, so a font
+ * may carry a few accented letters or symbols besides its main range.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -19,20 +25,72 @@
 #ifndef FONTS_H_
 #define FONTS_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*****************************************************************************
  * Public macros/types/enumerations/variables definitions
  ****************************************************************************/
 
+/**
+ * @brief  Glyph of a font in the generalized format
+ *
+ * Glyph rows are stored MSB first, each one padded to a whole byte, so a glyph
+ * takes (width * bpp + 7) / 8 * height bytes of the font bitmap.
+ */
+typedef struct
+{
+	uint32_t offset;  /*!< Offset of the first row of the glyph in the font bitmap */
+	uint8_t width;    /*!< Glyph bounding box width in pixels */
+	uint8_t height;   /*!< Glyph bounding box height in pixels */
+	uint8_t x_offset; /*!< Columns from the left of the character cell to the bounding box */
+	uint8_t y_offset; /*!< Rows from the top of the character cell to the bounding box */
+	uint8_t advance;  /*!< Width of the character cell in pixels */
+} FontGlyph_t;
+
+/**
+ * @brief  Kerning pair of a font in the generalized format
+ */
+typedef struct
+{
+	uint16_t left;  /*!< Left character of the pair */
+	uint16_t right; /*!< Right character of the pair */
+	int8_t adjust;  /*!< Pixels added to the advance of the left character */
+} FontKerning_t;
+
+/**
+ * @brief  Range of consecutive characters of a font in the generalized format
+ */
+typedef struct
+{
+	uint16_t first; /*!< First character of the range */
+	uint16_t count; /*!< Number of characters of the range */
+	uint16_t glyph; /*!< Index in the glyph table of the first character of the range */
+} FontRange_t;
+
 /**
  * @brief  Font structure
+ *
+ * Fixed width fonts only set FontWidth, FontHeight and data, with one 16 bits
+ * word per row and glyphs from ' ' to '~'. Fonts in the generalized format
+ * leave data as NULL and set bitmap and glyphs instead. Characters from first to
+ * first + count - 1 are found directly in the glyph table, any other character
+ * is searched in the sorted ranges.
  */
 typedef struct
 {
-	uint8_t FontWidth;    /*!< Font width in pixels */
-	uint8_t FontHeight;   /*!< Font height in pixels */
-	const uint16_t *data; /*!< Pointer to data font data array */
+	uint8_t FontWidth;              /*!< Font width in pixels, widest advance for generalized fonts */
+	uint8_t FontHeight;             /*!< Font height in pixels, height of every character cell */
+	const uint16_t *data;           /*!< Pointer to data font data array */
+	const uint8_t *bitmap;          /*!< Bit-packed rows of every glyph */
+	const FontGlyph_t *glyphs;      /*!< Glyph of each character, indexed by character - first */
+	uint16_t first;                 /*!< First character of the font */
+	uint16_t count;                 /*!< Number of characters of the font */
+	const FontKerning_t *kerning;   /*!< Kerning pairs sorted by left and then by right character */
+	uint16_t kerning_count;         /*!< Number of kerning pairs */
+	uint8_t bpp;                    /*!< Bits per pixel of the glyphs: 1, 2 or 4, 0 is the same as 1 */
+	const FontRange_t *ranges;      /*!< Ranges of characters outside the direct range, sorted by character */
+	uint16_t range_count;           /*!< Number of ranges */
 } Font_t;
 
 /**
@@ -50,6 +108,13 @@ extern Font_t font_11x18;
  */
 extern Font_t font_16x26;
 
-extern Font_t font_42x35;
+/**
+ * @brief  16 x 26 pixels font with only digits, space, '-', '.' and ':'
+ *
+ * @note Generated at build time by tools/fontpack.py from font_16x26, bit-packed
+ * and with each glyph cropped to its bounding box. The character set is declared
+ * in main/CMakeLists.txt.
+ */
+extern Font_t font_16x26_digits;
 
 #endif /* FONTS_H_ */
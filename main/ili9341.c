@@ -26,10 +26,14 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "ili9341.h"
+#include "rgb565.h"
+#include "rle565.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
 #include <string.h>
 
 /* === Macros definitions ====================================================================== */
@@ -38,15 +42,28 @@ SPDX-License-Identifier: MIT
 // More means more memory use, but less overhead for setting up / finishing transfers. Make sure 240
 // is dividable by this.
 #define PARALLEL_LINES    16
+#define STREAM_BUFFERS    2                         /*!< DMA buffers used to overlap filling with sending */
+#define STREAM_CHUNK_SIZE (PARALLEL_LINES * 320 * 2) /*!< Bytes sent by each DMA transfer, multiple of 4 */
 
 #define SPI_BR            51000000      /*!< Frequency of sck for SPI communication */
 #define MAX_PIXEL         320 * 240 * 2 /*!< Maximum number of bytes to write on LCD */
-#define MSK_BIT16         0x8000        /*!< 16th bit mask */
 #define MAX_VALUE_SIZE    256           /*!< Maximum length of a data array to \  prevent excessive use of memory */
 #define LEFT              -1            /*!< Horizontal grow direction */
 #define RIGHT             1             /*!< Horizontal grow direction */
 #define DOWN              1             /*!< Vertical grow direction */
 #define UP                -1            /*!< Vertical grow direction */
+#define SPAN_CACHE_SIZE   4             /*!< Number of radii whose corner span tables are kept cached */
+#define SPAN_MAX_RADIUS   63            /*!< Largest radius supported by rounded shapes and arcs */
+#define SIN_ONE           16384         /*!< Fixed point value of sin(90) in the sine table */
+#define TEXT_LINE_MAX     80            /*!< Maximum number of characters sent with a single window */
+#define TEXT_SCALE_MAX    4             /*!< Largest integer scale factor for text */
+
+#ifndef GLYPH_CACHE_SLOTS
+#define GLYPH_CACHE_SLOTS 16 /*!< Number of expanded glyphs kept in the cache, 0 disables the cache */
+#endif
+#ifndef GLYPH_CACHE_BYTES
+#define GLYPH_CACHE_BYTES (16 * 26 * 2) /*!< Size of the largest expanded glyph that can be cached, multiple of 4 */
+#endif
 
 /* Command List */
 #define SEND_PIXELS       0X00
@@ -116,6 +133,53 @@ typedef struct {
     uint8_t databytes; // No of data in data; bit 7 = delay after set; 0xFF = end of cmds.
 } lcd_init_cmd_t;
 
+/**
+ * @brief Half widths of a quarter circle row by row, computed once per radius
+ */
+typedef struct {
+    uint8_t radius;                     /*!< Radius of the table, 0 when the entry is free */
+    uint8_t width[SPAN_MAX_RADIUS + 1]; /*!< Half width of the circle at each row distance from its center */
+} span_table_t;
+
+/**
+ * @brief Glyph of any font format, as seen by the text rasterizer
+ */
+typedef struct {
+    const uint8_t * rows;    /*!< Bit-packed rows of a generalized font glyph, NULL for fixed width fonts */
+    const uint16_t * legacy; /*!< Rows of a fixed width font glyph */
+    uint8_t stride;          /*!< Bytes of each bit-packed row */
+    uint8_t bpp;             /*!< Bits per pixel, 2 and 4 are coverage levels blended between the text colors */
+    uint8_t width;           /*!< Bounding box width in pixels */
+    uint8_t height;          /*!< Bounding box height in pixels */
+    uint8_t x_offset;        /*!< Columns from the left of the character cell to the bounding box */
+    uint8_t y_offset;        /*!< Rows from the top of the character cell to the bounding box */
+    uint8_t advance;         /*!< Width of the character cell in pixels */
+} glyph_view_t;
+
+/**
+ * @brief Glyph expanded to pixels in panel byte order, kept in the glyph cache
+ */
+typedef struct {
+    const Font_t * font; /*!< Font of the glyph, NULL when the entry is free */
+    uint16_t code;       /*!< Character of the glyph */
+    uint16_t foreground; /*!< Color for the glyph */
+    uint16_t background; /*!< Color for the glyph background */
+    uint32_t last_use;   /*!< Text line where the glyph was used for the last time */
+} glyph_cache_entry_t;
+
+/**
+ * @brief Character of a text line with its colors
+ */
+typedef struct {
+    glyph_view_t view;      /*!< Glyph of the character */
+    uint16_t code;          /*!< Character, as a Unicode code point */
+    uint8_t bytes;          /*!< Length of the character in the UTF-8 string */
+    const uint8_t * cached; /*!< Expanded glyph in the cache, NULL to expand it from the font */
+    uint16_t foreground;    /*!< Color for the character */
+    uint16_t background;    /*!< Color for the character background */
+    uint8_t cell;           /*!< Width of the character cell, including the kerning with the next character */
+} text_glyph_t;
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
@@ -144,6 +208,130 @@ void WriteLCD(lcd_cmd_t * data);
  */
 void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
+/**
+ * @brief  		Define the columns of frame memory where MCU can access
+ * @param[in]  	x0: Start column
+ * @param[in]  	x1: End column, not lower than x0
+ * @retval 		None
+ */
+static void SetColumns(uint16_t x0, uint16_t x1);
+
+/**
+ * @brief  		Define the rows of frame memory where MCU can access
+ * @param[in]  	y0: Start row
+ * @param[in]  	y1: End row, not lower than y0
+ * @retval 		None
+ */
+static void SetRows(uint16_t y0, uint16_t y1);
+
+/**
+ * @brief  		Clip a sprite against its sheet and the LCD area
+ * @param[inout]	x: X position of the sprite on the LCD
+ * @param[inout]	y: Y position of the sprite on the LCD
+ * @param[in]  	sheet: Sprite sheet
+ * @param[inout]	src_x: X position of the sprite in the sheet
+ * @param[inout]	src_y: Y position of the sprite in the sheet
+ * @param[inout]	width: Sprite width
+ * @param[inout]	height: Sprite height
+ * @retval 		false when nothing of the sprite is visible
+ */
+static bool ClipSprite(int16_t * x, int16_t * y, const ili9341_sprite_sheet_t * sheet, uint16_t * src_x,
+                       uint16_t * src_y, uint16_t * width, uint16_t * height);
+
+/**
+ * @brief  		Pixel source that decodes a compressed picture
+ * @param[in]  	context: Decoder of the picture
+ * @param[out] 	buffer: Buffer that receives the pixels
+ * @param[in]  	pixels: Maximum number of pixels to write
+ * @retval 		Number of pixels written, 0 when the picture is complete
+ */
+static uint32_t DecodeCompressed(void * context, uint8_t * buffer, uint32_t pixels);
+
+/**
+ * @brief  		Decode a character of an UTF-8 string
+ * @note		Characters outside the basic multilingual plane decode as a single U+FFFD, each byte of a malformed
+ *			sequence, overlong encoding or surrogate decodes as one U+FFFD
+ * @param[in]  	str: First byte of the character
+ * @param[in]  	length: Bytes left in the string
+ * @param[out] 	bytes: Length of the character in the string, at least one
+ * @retval 		Character as a Unicode code point
+ */
+static uint16_t DecodeUtf8(const char * str, uint16_t length, uint8_t * bytes);
+
+/**
+ * @brief  		Get the glyph of a character, characters missing from the font use the glyph of a space
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	code: Character of the glyph
+ * @param[out] 	view: Glyph of the character
+ * @retval 		None
+ */
+static void GetGlyph(const Font_t * font, uint16_t code, glyph_view_t * view);
+
+/**
+ * @brief  		Get the kerning between two characters
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	left: Left character of the pair
+ * @param[in]  	right: Right character of the pair
+ * @retval 		Pixels to add to the advance of the left character
+ */
+static int8_t GetKerning(const Font_t * font, uint16_t left, uint16_t right);
+
+/**
+ * @brief  		Expand a row of a character cell to pixels in panel byte order
+ * @param[out] 	pixel: Destination of the pixels
+ * @param[in]  	view: Glyph of the character
+ * @param[in]  	row: Row of the character cell
+ * @param[in]  	cell: Width of the character cell, the glyph is clipped to it
+ * @param[in]  	lut: Expansion table with the colors of the character
+ * @param[in]  	blend: Blend table with the colors of the character, only used by anti-aliased glyphs
+ * @retval 		Pointer to the pixel following the row
+ */
+static uint8_t * ExpandCellRow(uint8_t * pixel, const glyph_view_t * view, uint16_t row, uint8_t cell,
+                               const rgb565_nibble_lut_t * lut, const rgb565_blend_lut_t * blend);
+
+/**
+ * @brief  		Draw a line of text with a single window, rasterizing row by row across all glyphs
+ * @param[in]  	x: X position of top left corner of the line
+ * @param[in]  	y: Y position of top left corner of the line
+ * @param[in]  	str: First character of the line
+ * @param[in]  	length: Number of UTF-8 bytes up to the end of the line
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	runs: Colors of consecutive groups of characters
+ * @param[in]  	run_count: Number of color runs
+ * @param[in]  	first: Position of the first character of the line in the color runs
+ * @param[in]  	scale: Integer scale factor, from 1 to TEXT_SCALE_MAX
+ * @retval 		Number of characters drawn, those that fit up to the right edge of the LCD
+ */
+static uint16_t DrawTextLine(uint16_t x, uint16_t y, const char * str, uint16_t length, Font_t * font,
+                             const ili9341_text_run_t * runs, uint8_t run_count, uint16_t first, uint8_t scale);
+
+/**
+ * @brief  		Draw a string line by line, wrapping it at the right edge of the LCD
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	runs: Colors for consecutive groups of characters
+ * @param[in]  	run_count: Number of color runs, at least one
+ * @param[in]  	scale: Integer scale factor, from 1 to TEXT_SCALE_MAX
+ * @retval 		None
+ */
+static void DrawText(uint16_t x, uint16_t y, const char * str, Font_t * font, const ili9341_text_run_t * runs,
+                     uint8_t run_count, uint8_t scale);
+
+/**
+ * @brief  		Get a glyph expanded with some colors from the cache, expanding it on a miss
+ * @note		Glyphs used by the current text line are never evicted
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	code: Character of the glyph
+ * @param[in]  	view: Glyph of the character
+ * @param[in]  	foreground: Color for the glyph
+ * @param[in]  	background: Color for the glyph background
+ * @retval 		Character cell, advance by font height pixels in panel byte order, NULL when it can not be cached
+ */
+static const uint8_t * GlyphCacheGet(const Font_t * font, uint16_t code, const glyph_view_t * view,
+                                     uint16_t foreground, uint16_t background);
+
 /**
  * @brief  		Fill an srea of LCD with a determined color
  * @param[in]  	x1: Start column
@@ -155,6 +343,60 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
  */
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
 
+/**
+ * @brief  		Get the next free DMA buffer, waiting for its previous transfer to finish if needed
+ * @retval 		Pointer to a DMA capable buffer of STREAM_CHUNK_SIZE bytes
+ */
+static uint8_t * StreamBuffer(void);
+
+/**
+ * @brief  		Queue pixel data for a DMA transfer without waiting for it to finish
+ * @note		Data must be DMA capable, word aligned and remain valid until StreamWait returns
+ * @param[in]  	data: Pixel data, usually the buffer returned by StreamBuffer
+ * @param[in]  	len: Number of bytes to send, up to STREAM_CHUNK_SIZE
+ * @retval 		None
+ */
+static void StreamQueue(const uint8_t * data, uint32_t len);
+
+/**
+ * @brief  		Wait until every queued DMA transfer has finished
+ * @retval 		None
+ */
+static void StreamWait(void);
+
+/**
+ * @brief  		Fill a single row span, clipped to the LCD area
+ * @param[in]  	x0: Start column, may be outside the LCD
+ * @param[in]  	x1: End column, may be outside the LCD
+ * @param[in]  	y: Row, may be outside the LCD
+ * @param[in]	color: color
+ * @retval 		None
+ */
+static void FillSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color);
+
+/**
+ * @brief  		Get the corner span table of a radius, building it on a cache miss
+ * @param[in]  	radius: Circle radius, up to SPAN_MAX_RADIUS
+ * @retval 		Half width of the circle for each row distance from its center
+ */
+static const uint8_t * GetSpanTable(uint8_t radius);
+
+/**
+ * @brief  		Sine of an angle in degrees with SIN_ONE fixed point scale
+ * @param[in]  	angle: Angle in degrees
+ * @retval 		Sine of the angle
+ */
+static int32_t Sine(uint16_t angle);
+
+/**
+ * @brief  		Column where a ray from the center of an arc crosses a row
+ * @param[in]  	dy: Row relative to the center of the arc
+ * @param[in]  	angle: Ray angle in degrees, clockwise from 12 o'clock
+ * @param[in]  	limit: Absolute value used when the ray never reaches the row
+ * @retval 		Column relative to the center of the arc
+ */
+static int16_t RayColumn(int16_t dy, uint16_t angle, int16_t limit);
+
 /* === Public variable definitions ============================================================= */
 
 static spi_device_handle_t spi;
@@ -228,6 +470,41 @@ orientation_properties_t lcd_orientation = {
     ILI9341_Portrait_1,
 }; /*!< Default orientation configuration */
 
+static uint8_t * stream_buffer[STREAM_BUFFERS];                /*!< DMA capable buffers for pixel data */
+static spi_transaction_t stream_transaction[STREAM_BUFFERS]; /*!< Transaction of each queued transfer */
+static uint8_t stream_next;                                  /*!< Slot used by the next queued transfer */
+static uint8_t stream_pending;                               /*!< Transfers queued and not yet finished */
+static uint8_t batch_depth;                                  /*!< Nesting level of the open drawing groups */
+
+static uint8_t * glyph_cache_pixels;                         /*!< DMA capable storage of the cached glyphs */
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_SLOTS + 1]; /*!< Cached glyphs, plus a spare entry if disabled */
+static uint32_t glyph_cache_clock = 1;                         /*!< Number of the text line being drawn */
+static ili9341_glyph_cache_stats_t glyph_cache_stats;          /*!< Glyph cache counters */
+static ili9341_bus_stats_t bus_stats;                          /*!< SPI transfer counters */
+static uint16_t window_columns[2] = {UINT16_MAX, UINT16_MAX};  /*!< Columns last sent to the LCD, unknown if MAX */
+static uint16_t window_rows[2] = {UINT16_MAX, UINT16_MAX};     /*!< Rows last sent to the LCD, unknown if MAX */
+static text_glyph_t text_glyphs[TEXT_LINE_MAX];                /*!< Characters of the text line being drawn */
+static uint8_t text_row[ILI9341_HEIGHT]; /*!< Row of a scaled text line before scaling, up to half the LCD width */
+
+static span_table_t span_cache[SPAN_CACHE_SIZE]; /*!< Corner span tables of the last radii used */
+static uint8_t span_cache_next;                  /*!< Next entry to replace on a cache miss */
+
+/**
+ * @brief Sine of 0 to 90 degrees, scaled by SIN_ONE
+ */
+static const uint16_t sine_table[] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
 /* === Private function definitions ============================================================ */
 
 /* Send a command to the LCD. Uses spi_device_polling_transmit, which waits
@@ -240,6 +517,7 @@ orientation_properties_t lcd_orientation = {
 void lcd_cmd(const uint8_t cmd, bool keep_cs_active) {
     esp_err_t ret;
     spi_transaction_t t;
+    StreamWait();             // Polling transfers can not start while DMA transfers are queued
     memset(&t, 0, sizeof(t)); // Zero out the transaction
     t.length = 8;             // Command is 8 bits
     t.tx_buffer = &cmd;       // The data is the cmd itself
@@ -249,6 +527,9 @@ void lcd_cmd(const uint8_t cmd, bool keep_cs_active) {
     }
     ret = spi_device_polling_transmit(spi, &t); // Transmit!
     assert(ret == ESP_OK);                      // Should have had no issues.
+    bus_stats.transactions++;
+    bus_stats.commands++;
+    bus_stats.bytes++;
 }
 
 /* Send data to the LCD. Uses spi_device_polling_transmit, which waits until the
@@ -264,12 +545,15 @@ void lcd_data(const uint8_t * data, int len) {
     if (len == 0) {
         return; // no need to send anything
     }
+    StreamWait();                               // Polling transfers can not start while DMA transfers are queued
     memset(&t, 0, sizeof(t));                   // Zero out the transaction
     t.length = len * 8;                         // Len is in bytes, transaction length is in bits.
     t.tx_buffer = data;                         // Data
     t.user = (void *)1;                         // D/C needs to be set to 1
     ret = spi_device_polling_transmit(spi, &t); // Transmit!
     assert(ret == ESP_OK);                      // Should have had no issues.
+    bus_stats.transactions++;
+    bus_stats.bytes += len;
 }
 
 // This function is called (in irq context!) just before a transmission starts. It will
@@ -288,7 +572,7 @@ void spi_config() {
         .sclk_io_num = ILI9341_PIN_NUM_CLK,
         .quadwp_io_num = -1,
         .quadhd_io_num = -1,
-        .max_transfer_sz = PARALLEL_LINES * 320 * 2 + 8,
+        .max_transfer_sz = STREAM_CHUNK_SIZE + 8,
     };
 
     spi_device_interface_config_t devcfg = {
@@ -310,6 +594,59 @@ void spi_config() {
     // Attach the LCD to the SPI bus
     ret = spi_bus_add_device(ILI9341_SPI_PORT, &devcfg, &spi);
     ESP_ERROR_CHECK(ret);
+
+    // Allocate the buffers used to stream pixels with DMA
+    for (int i = 0; i < STREAM_BUFFERS; i++) {
+        stream_buffer[i] = heap_caps_malloc(STREAM_CHUNK_SIZE, MALLOC_CAP_DMA);
+        assert(stream_buffer[i] != NULL);
+    }
+
+    // The glyph cache is optional, text is expanded from the fonts when it can not be allocated
+    if (GLYPH_CACHE_SLOTS > 0) {
+        glyph_cache_pixels = heap_caps_malloc(GLYPH_CACHE_SLOTS * GLYPH_CACHE_BYTES, MALLOC_CAP_DMA);
+    }
+}
+
+static uint8_t * StreamBuffer(void) {
+    spi_transaction_t * done;
+    esp_err_t ret;
+
+    /* Slots are used in order, so when all of them are busy the oldest one is the next */
+    if (stream_pending == STREAM_BUFFERS) {
+        ret = spi_device_get_trans_result(spi, &done, portMAX_DELAY);
+        assert(ret == ESP_OK);
+        stream_pending--;
+    }
+    return stream_buffer[stream_next];
+}
+
+static void StreamQueue(const uint8_t * data, uint32_t len) {
+    spi_transaction_t * t;
+    esp_err_t ret;
+
+    StreamBuffer();
+    t = &stream_transaction[stream_next];
+    memset(t, 0, sizeof(*t));
+    t->length = len * 8;
+    t->tx_buffer = data;
+    t->user = (void *)1; // D/C needs to be set to 1
+    ret = spi_device_queue_trans(spi, t, portMAX_DELAY);
+    assert(ret == ESP_OK);
+    stream_pending++;
+    stream_next = (stream_next + 1) % STREAM_BUFFERS;
+    bus_stats.transactions++;
+    bus_stats.bytes += len;
+}
+
+static void StreamWait(void) {
+    spi_transaction_t * done;
+    esp_err_t ret;
+
+    while (stream_pending > 0) {
+        ret = spi_device_get_trans_result(spi, &done, portMAX_DELAY);
+        assert(ret == ESP_OK);
+        stream_pending--;
+    }
 }
 
 void WriteLCD(lcd_cmd_t * data) {
@@ -339,16 +676,36 @@ void SetCursorPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
         y0 = y1;
         y1 = aux;
     }
+    SetColumns(x0, x1);
+    SetRows(y0, y1);
+}
+
+static void SetColumns(uint16_t x0, uint16_t x1) {
+    /* The LCD keeps the columns until they are set again, MEM_WRITE always starts at the top left corner */
+    if ((window_columns[0] == x0) && (window_columns[1] == x1)) {
+        bus_stats.windows_skipped++;
+        return;
+    }
     uint8_t columns[] = {HighByte(x0), LowByte(x0), HighByte(x1), LowByte(x1)};
     lcd_cmd_t lcd_columns = {COLUMN_ADDR_SET, 4, columns};
+    WriteLCD(&lcd_columns);
+    window_columns[0] = x0;
+    window_columns[1] = x1;
+}
+
+static void SetRows(uint16_t y0, uint16_t y1) {
+    if ((window_rows[0] == y0) && (window_rows[1] == y1)) {
+        bus_stats.windows_skipped++;
+        return;
+    }
     uint8_t rows[] = {HighByte(y0), LowByte(y0), HighByte(y1), LowByte(y1)};
     lcd_cmd_t lcd_rows = {PAGE_ADDR_SET, 4, rows};
-    WriteLCD(&lcd_columns);
     WriteLCD(&lcd_rows);
+    window_rows[0] = y0;
+    window_rows[1] = y1;
 }
 
 void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
-    static uint16_t i;
     static int32_t bytes_count;
     static int16_t x_dist, y_dist;
     static uint8_t pixel[MAX_VALUE_SIZE];
@@ -366,10 +723,7 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
     /* Define area to fill */
     SetCursorPosition(x0, y0, x1, y1);
 
-    for (i = 0; i < MAX_VALUE_SIZE; i += 2) {
-        pixel[i] = HighByte(color);
-        pixel[i + 1] = LowByte(color);
-    }
+    RGB565Fill(pixel, color, MAX_VALUE_SIZE / 2);
     /* Start writing LCD memory */
     lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
     WriteLCD(&lcd_write);
@@ -383,6 +737,538 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
     WriteLCD(&lcd_pixel);
 }
 
+static void FillSpan(int16_t x0, int16_t x1, int16_t y, uint16_t color) {
+    if ((y < 0) || (y >= lcd_orientation.height) || (x1 < 0) || (x0 >= lcd_orientation.width)) {
+        return;
+    }
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (x1 >= lcd_orientation.width) {
+        x1 = lcd_orientation.width - 1;
+    }
+    if (x0 <= x1) {
+        Fill(x0, y, x1, y, color);
+    }
+}
+
+static const uint8_t * GetSpanTable(uint8_t radius) {
+    span_table_t * table;
+    int16_t f, ddF_x, ddF_y, x, y;
+
+    for (uint8_t i = 0; i < SPAN_CACHE_SIZE; i++) {
+        if (span_cache[i].radius == radius) {
+            return span_cache[i].width;
+        }
+    }
+
+    /* Cache miss, walk the same midpoint circle used by ILI9341DrawFilledCircle once */
+    table = &span_cache[span_cache_next];
+    span_cache_next = (span_cache_next + 1) % SPAN_CACHE_SIZE;
+    memset(table->width, 0, sizeof(table->width));
+    table->radius = radius;
+    table->width[0] = radius;
+
+    f = 1 - radius;
+    ddF_x = 1;
+    ddF_y = -2 * radius;
+    x = 0;
+    y = radius;
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (table->width[y] < x) {
+            table->width[y] = x;
+        }
+        if (table->width[x] < y) {
+            table->width[x] = y;
+        }
+    }
+    return table->width;
+}
+
+static int32_t Sine(uint16_t angle) {
+    angle = angle % 360;
+    if (angle <= 90) {
+        return sine_table[angle];
+    } else if (angle <= 180) {
+        return sine_table[180 - angle];
+    } else if (angle <= 270) {
+        return -sine_table[angle - 180];
+    }
+    return -sine_table[360 - angle];
+}
+
+static int16_t RayColumn(int16_t dy, uint16_t angle, int16_t limit) {
+    int32_t sine = Sine(angle);
+    int32_t cosine = Sine(angle + 90);
+    int32_t column;
+
+    /* A ray leaving the center with direction (sin, -cos) crosses row dy at -dy * tan */
+    if (cosine == 0) {
+        return (sine > 0) ? limit : -limit;
+    }
+    column = (-dy * sine) / cosine;
+    if (column > limit) {
+        column = limit;
+    } else if (column < -limit) {
+        column = -limit;
+    }
+    return column;
+}
+
+static uint32_t DecodeCompressed(void * context, uint8_t * buffer, uint32_t pixels) {
+    return RLE565Decode(context, buffer, pixels);
+}
+
+static bool ClipSprite(int16_t * x, int16_t * y, const ili9341_sprite_sheet_t * sheet, uint16_t * src_x,
+                       uint16_t * src_y, uint16_t * width, uint16_t * height) {
+    int32_t skip;
+
+    /* Source rectangle inside the sheet */
+    if ((*src_x >= sheet->width) || (*src_y >= sheet->height)) {
+        return false;
+    }
+    if (*width > sheet->width - *src_x) {
+        *width = sheet->width - *src_x;
+    }
+    if (*height > sheet->height - *src_y) {
+        *height = sheet->height - *src_y;
+    }
+
+    /* Destination rectangle inside the LCD */
+    if (*x < 0) {
+        skip = -*x;
+        if (skip >= *width) {
+            return false;
+        }
+        *src_x += skip;
+        *width -= skip;
+        *x = 0;
+    }
+    if (*y < 0) {
+        skip = -*y;
+        if (skip >= *height) {
+            return false;
+        }
+        *src_y += skip;
+        *height -= skip;
+        *y = 0;
+    }
+    if ((*x >= lcd_orientation.width) || (*y >= lcd_orientation.height)) {
+        return false;
+    }
+    if (*x + *width > lcd_orientation.width) {
+        *width = lcd_orientation.width - *x;
+    }
+    if (*y + *height > lcd_orientation.height) {
+        *height = lcd_orientation.height - *y;
+    }
+    return (*width > 0) && (*height > 0);
+}
+
+static uint16_t DecodeUtf8(const char * str, uint16_t length, uint8_t * bytes) {
+    const uint8_t * data = (const uint8_t *)str;
+    uint32_t code;
+    uint8_t count;
+
+    *bytes = 1;
+    if (data[0] < 0x80) {
+        return data[0];
+    } else if ((data[0] & 0xE0) == 0xC0) {
+        count = 2;
+        code = data[0] & 0x1F;
+    } else if ((data[0] & 0xF0) == 0xE0) {
+        count = 3;
+        code = data[0] & 0x0F;
+    } else if ((data[0] >= 0xF0) && (data[0] <= 0xF4)) {
+        count = 4;
+        code = data[0] & 0x07;
+    } else {
+        return 0xFFFD;
+    }
+    if (count > length) {
+        return 0xFFFD;
+    }
+    for (uint8_t index = 1; index < count; index++) {
+        if ((data[index] & 0xC0) != 0x80) {
+            return 0xFFFD;
+        }
+        code = (code << 6) | (data[index] & 0x3F);
+    }
+    /* Overlong encodings are rejected, they would map different strings to the same text, and so are surrogates,
+     * which only encode characters in UTF-16 */
+    if ((code < 0x80) || ((count == 3) && (code < 0x800)) || ((count == 4) && (code < 0x10000))) {
+        return 0xFFFD;
+    }
+    if (((code >= 0xD800) && (code <= 0xDFFF)) || (code > 0x10FFFF)) {
+        return 0xFFFD;
+    }
+    /* A valid character outside the basic multilingual plane is consumed whole and replaced by a single U+FFFD */
+    *bytes = count;
+    return (count == 4) ? 0xFFFD : code;
+}
+
+static void GetGlyph(const Font_t * font, uint16_t code, glyph_view_t * view) {
+    const FontGlyph_t * glyph;
+    const FontRange_t * range;
+    uint16_t index, low, high, middle;
+
+    if (font->glyphs == NULL) {
+        if ((code < ' ') || (code > '~')) {
+            code = ' ';
+        }
+        view->rows = NULL;
+        view->legacy = font->data + (code - ' ') * font->FontHeight;
+        view->stride = 0;
+        view->bpp = 1;
+        view->width = font->FontWidth;
+        view->height = font->FontHeight;
+        view->x_offset = 0;
+        view->y_offset = 0;
+        view->advance = font->FontWidth;
+        return;
+    }
+
+    if ((code >= font->first) && (code - font->first < font->count)) {
+        index = code - font->first;
+    } else {
+        /* Characters outside the direct range are searched in the sorted ranges */
+        low = 0;
+        high = font->range_count;
+        while (low < high) {
+            middle = (low + high) / 2;
+            range = &font->ranges[middle];
+            if (code < range->first) {
+                high = middle;
+            } else if (code - range->first >= range->count) {
+                low = middle + 1;
+            } else {
+                break;
+            }
+        }
+        if (low < high) {
+            index = font->ranges[middle].glyph + (code - font->ranges[middle].first);
+        } else if ((' ' >= font->first) && (' ' - font->first < font->count)) {
+            index = ' ' - font->first;
+        } else {
+            index = 0;
+        }
+    }
+    glyph = &font->glyphs[index];
+    view->rows = font->bitmap + glyph->offset;
+    view->legacy = NULL;
+    view->bpp = (font->bpp == 0) ? 1 : font->bpp;
+    view->stride = (glyph->width * view->bpp + 7) / 8;
+    view->width = glyph->width;
+    view->height = glyph->height;
+    view->x_offset = glyph->x_offset;
+    view->y_offset = glyph->y_offset;
+    view->advance = glyph->advance;
+}
+
+static int8_t GetKerning(const Font_t * font, uint16_t left, uint16_t right) {
+    const FontKerning_t * pair;
+    uint32_t key = ((uint32_t)left << 16) | right;
+    uint16_t low = 0;
+    uint16_t high = font->kerning_count;
+    uint16_t middle;
+
+    /* Pairs are sorted by left and then by right character, so both can be searched as a single key */
+    while (low < high) {
+        middle = (low + high) / 2;
+        pair = &font->kerning[middle];
+        if ((((uint32_t)pair->left << 16) | pair->right) < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if ((low < font->kerning_count) && (font->kerning[low].left == left) && (font->kerning[low].right == right)) {
+        return font->kerning[low].adjust;
+    }
+    return 0;
+}
+
+static uint8_t * ExpandCellRow(uint8_t * pixel, const glyph_view_t * view, uint16_t row, uint8_t cell,
+                               const rgb565_nibble_lut_t * lut, const rgb565_blend_lut_t * blend) {
+    const uint8_t * bits;
+    uint8_t x = 0;
+    uint8_t ink, chunk;
+
+    /* Glyph pixels inside the cell, the rest of the row is background */
+    if ((row >= view->y_offset) && (row - view->y_offset < view->height) && (view->x_offset < cell)) {
+        x = view->x_offset;
+        while (x > 0) {
+            chunk = (x > 32) ? 32 : x;
+            pixel = RGB565ExpandBits(pixel, 0, chunk, lut);
+            x -= chunk;
+        }
+        x = view->x_offset;
+        ink = (view->width < cell - x) ? view->width : cell - x;
+        if (view->rows == NULL) {
+            pixel = RGB565ExpandBits(pixel, (uint32_t)view->legacy[row] << 16, ink, lut);
+            x += ink;
+        } else if (view->bpp > 1) {
+            pixel = RGB565ExpandLevels(pixel, view->rows + (row - view->y_offset) * view->stride, ink, blend);
+            x += ink;
+        } else {
+            bits = view->rows + (row - view->y_offset) * view->stride;
+            while (ink > 0) {
+                chunk = (ink > 32) ? 32 : ink;
+                pixel = RGB565ExpandBits(pixel,
+                                         ((uint32_t)bits[0] << 24) | ((chunk > 8) ? (uint32_t)bits[1] << 16 : 0) |
+                                             ((chunk > 16) ? (uint32_t)bits[2] << 8 : 0) |
+                                             ((chunk > 24) ? (uint32_t)bits[3] : 0),
+                                         chunk, lut);
+                bits += 4;
+                ink -= chunk;
+                x += chunk;
+            }
+        }
+    }
+    while (x < cell) {
+        chunk = (cell - x > 32) ? 32 : cell - x;
+        pixel = RGB565ExpandBits(pixel, 0, chunk, lut);
+        x += chunk;
+    }
+    return pixel;
+}
+
+static const uint8_t * GlyphCacheGet(const Font_t * font, uint16_t code, const glyph_view_t * view,
+                                     uint16_t foreground, uint16_t background) {
+    static rgb565_nibble_lut_t lut;
+    static rgb565_blend_lut_t blend;
+    glyph_cache_entry_t * entry;
+    glyph_cache_entry_t * victim = NULL;
+    uint8_t * pixel;
+    uint8_t slot;
+
+    if ((glyph_cache_pixels == NULL) || (view->advance * font->FontHeight * 2 > GLYPH_CACHE_BYTES)) {
+        return NULL;
+    }
+
+    for (slot = 0; slot < GLYPH_CACHE_SLOTS; slot++) {
+        entry = &glyph_cache[slot];
+        if ((entry->font == font) && (entry->code == code) && (entry->foreground == foreground) &&
+            (entry->background == background)) {
+            entry->last_use = glyph_cache_clock;
+            glyph_cache_stats.hits++;
+            return glyph_cache_pixels + slot * GLYPH_CACHE_BYTES;
+        }
+        /* Least recently used entry, free entries have never been used */
+        if ((entry->last_use != glyph_cache_clock) && ((victim == NULL) || (entry->last_use < victim->last_use))) {
+            victim = entry;
+        }
+    }
+
+    glyph_cache_stats.misses++;
+    if (victim == NULL) {
+        return NULL;
+    }
+    if (victim->font != NULL) {
+        glyph_cache_stats.evictions++;
+    }
+    victim->font = font;
+    victim->code = code;
+    victim->foreground = foreground;
+    victim->background = background;
+    victim->last_use = glyph_cache_clock;
+
+    /* The evicted glyph may still be read by a queued DMA transfer */
+    StreamWait();
+    if ((lut.foreground != foreground) || (lut.background != background)) {
+        RGB565BuildNibbleLut(&lut, foreground, background);
+    }
+    if ((view->bpp > 1) &&
+        ((blend.foreground != foreground) || (blend.background != background) || (blend.bpp != view->bpp))) {
+        RGB565BuildBlendLut(&blend, foreground, background, view->bpp);
+    }
+    pixel = glyph_cache_pixels + (victim - glyph_cache) * GLYPH_CACHE_BYTES;
+    for (uint16_t row = 0; row < font->FontHeight; row++) {
+        pixel = ExpandCellRow(pixel, view, row, view->advance, &lut, &blend);
+    }
+    return glyph_cache_pixels + (victim - glyph_cache) * GLYPH_CACHE_BYTES;
+}
+
+static uint16_t DrawTextLine(uint16_t x, uint16_t y, const char * str, uint16_t length, Font_t * font,
+                             const ili9341_text_run_t * runs, uint8_t run_count, uint16_t first, uint8_t scale) {
+    static rgb565_nibble_lut_t lut;
+    static rgb565_blend_lut_t blend;
+    const ili9341_text_run_t * run;
+    text_glyph_t * glyph;
+    uint32_t row_bytes, used;
+    uint16_t row, left, count, width;
+    uint16_t offset = 0;
+    int16_t kerning;
+    uint8_t * buffer;
+    uint8_t * pixel;
+    uint8_t copy;
+
+    /* Resolve the glyph and colors of each character once, the last run keeps its colors until the end of the
+     * string. Kerning widens or narrows the cell of the previous character only when both share the line */
+    glyph_cache_clock++;
+    run = runs;
+    left = run->length;
+    count = 0;
+    width = 0;
+    for (uint16_t c = 0; (offset < length) && (count < TEXT_LINE_MAX); c++) {
+        while ((left == 0) && (run < runs + run_count - 1)) {
+            run++;
+            left = run->length;
+        }
+        if (left > 0) {
+            left--;
+        }
+        if (c < first) {
+            continue;
+        }
+        glyph = &text_glyphs[count];
+        glyph->code = DecodeUtf8(str + offset, length - offset, &glyph->bytes);
+        GetGlyph(font, glyph->code, &glyph->view);
+        kerning = 0;
+        if ((count > 0) && (font->kerning_count > 0)) {
+            kerning = GetKerning(font, text_glyphs[count - 1].code, glyph->code);
+            if (text_glyphs[count - 1].cell + kerning < 0) {
+                kerning = -text_glyphs[count - 1].cell;
+            }
+        }
+        if (x + (width + kerning + glyph->view.advance) * scale > lcd_orientation.width) {
+            break;
+        }
+        if (count > 0) {
+            text_glyphs[count - 1].cell += kerning;
+        }
+        width += kerning + glyph->view.advance;
+        glyph->cell = glyph->view.advance;
+        glyph->foreground = run->foreground;
+        glyph->background = run->background;
+        glyph->cached = GlyphCacheGet(font, glyph->code, &glyph->view, run->foreground, run->background);
+        offset += glyph->bytes;
+        count++;
+    }
+    if ((count == 0) || (width == 0)) {
+        return count;
+    }
+
+    SetCursorPosition(x, y, x + width * scale - 1, y + font->FontHeight * scale - 1);
+
+    /* Start writing LCD memory */
+    lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+    WriteLCD(&lcd_write);
+
+    /* A single cached glyph goes to the panel without any copy */
+    if ((count == 1) && (scale == 1) && (text_glyphs[0].cached != NULL)) {
+        StreamQueue(text_glyphs[0].cached, text_glyphs[0].cell * 2 * font->FontHeight);
+        return count;
+    }
+
+    row_bytes = (uint32_t)width * scale * 2;
+    buffer = StreamBuffer();
+    used = 0;
+    for (row = 0; row < font->FontHeight; row++) {
+        /* Each DMA buffer holds as many complete rows of the line as fit on it */
+        if (used + row_bytes * scale > STREAM_CHUNK_SIZE) {
+            StreamQueue(buffer, used);
+            buffer = StreamBuffer();
+            used = 0;
+        }
+        /* Scaled lines are rasterized at their original size and then widened into the DMA buffer */
+        pixel = (scale > 1) ? text_row : buffer + used;
+
+        for (uint16_t c = 0; c < count; c++) {
+            glyph = &text_glyphs[c];
+            if (glyph->cached != NULL) {
+                /* Cached cells are as wide as the advance, kerning clips them or pads them with background */
+                copy = (glyph->cell < glyph->view.advance) ? glyph->cell : glyph->view.advance;
+                memcpy(pixel, glyph->cached + row * glyph->view.advance * 2, copy * 2);
+                pixel += copy * 2;
+                if (glyph->cell > copy) {
+                    RGB565Fill(pixel, glyph->background, glyph->cell - copy);
+                    pixel += (glyph->cell - copy) * 2;
+                }
+                continue;
+            }
+            /* The expansion and blend tables are only rebuilt when the colors change */
+            if ((lut.foreground != glyph->foreground) || (lut.background != glyph->background)) {
+                RGB565BuildNibbleLut(&lut, glyph->foreground, glyph->background);
+            }
+            if ((glyph->view.bpp > 1) && ((blend.foreground != glyph->foreground) ||
+                                          (blend.background != glyph->background) || (blend.bpp != glyph->view.bpp))) {
+                RGB565BuildBlendLut(&blend, glyph->foreground, glyph->background, glyph->view.bpp);
+            }
+            pixel = ExpandCellRow(pixel, &glyph->view, row, glyph->cell, &lut, &blend);
+        }
+        if (scale > 1) {
+            RGB565Scale(buffer + used, text_row, width, scale);
+            for (copy = 1; copy < scale; copy++) {
+                memcpy(buffer + used + copy * row_bytes, buffer + used, row_bytes);
+            }
+        }
+        used += row_bytes * scale;
+    }
+    StreamQueue(buffer, used);
+    return count;
+}
+
+static void DrawText(uint16_t x, uint16_t y, const char * str, Font_t * font, const ili9341_text_run_t * runs,
+                     uint8_t run_count, uint8_t scale) {
+    glyph_view_t view;
+    uint16_t lcd_x = x;
+    uint16_t lcd_y = y;
+    uint16_t length, fit, drawn = 0;
+    uint8_t bytes;
+
+    while (*str != '\0') /* End of string */
+    {
+        /* New line */
+        if (*str == '\n') {
+            lcd_y += (font->FontHeight + 1) * scale;
+            /* if after \n is also \r, than go to the left of the screen */
+            if (*(str + 1) == '\r') {
+                lcd_x = 0;
+                str++;
+            } else {
+                lcd_x = x;
+            }
+            str++;
+            continue;
+        } else if (*str == '\r') {
+            str++;
+            continue;
+        }
+
+        /* Characters up to the end of the line share a single window */
+        for (length = 0; (str[length] != '\0') && (str[length] != '\n') && (str[length] != '\r'); length++) {
+        }
+
+        /* If at the end of a line of display, go to new line and set x to 0 position */
+        GetGlyph(font, DecodeUtf8(str, length, &bytes), &view);
+        if ((lcd_x + view.advance * scale) > lcd_orientation.width) {
+            lcd_y += font->FontHeight * scale;
+            lcd_x = 0;
+        }
+
+        fit = DrawTextLine(lcd_x, lcd_y, str, length, font, runs, run_count, drawn, scale);
+        if (fit == 0) {
+            /* Glyph wider than the LCD */
+            break;
+        }
+        for (uint16_t c = 0; c < fit; c++) {
+            lcd_x += text_glyphs[c].cell * scale;
+            str += text_glyphs[c].bytes;
+        }
+        drawn += fit;
+    }
+}
+
 /* === Public function implementation ========================================================== */
 
 void ILI9341Init(void) {
@@ -406,10 +1292,11 @@ void ILI9341Init(void) {
     //WriteLCD(&lcd_reset);
     //vTaskDelay(10 / portTICK_PERIOD_MS);
 
-    /* Send initial configuration to LCD */
+    /* Send initial configuration to LCD, it sets the whole screen as window */
     for (uint8_t i = 0; i < sizeof(lcd_init) / sizeof(lcd_cmd_t); i++) {
         WriteLCD(&lcd_init[i]);
     }
+    window_columns[0] = window_rows[0] = UINT16_MAX;
     /* It will be necessary to wait 5msec before sending next command after sleep out */
     WriteLCD(&lcd_sleep_out);
     vTaskDelay(10 / portTICK_PERIOD_MS);
@@ -472,107 +1359,108 @@ void ILI9341Rotate(ili9341_orientation_t orientation) {
     }
     lcd_cmd_t lcd_mem_acc = {MEM_ACC_CTRL, 1, mem_acc};
     WriteLCD(&lcd_mem_acc);
+    /* The window limits depend on the orientation, so the next window is always sent */
+    window_columns[0] = window_rows[0] = UINT16_MAX;
 }
 
-void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t * font, uint16_t foreground, uint16_t background) {
-    static uint16_t i, j, k;
-    static uint16_t char_row;
-    static uint16_t lcd_x, lcd_y;
-    static int32_t bytes_count;
-    static uint8_t pixel[MAX_VALUE_SIZE];
+void ILI9341BeginBatch(void) {
+    esp_err_t ret;
+
+    if (batch_depth++ == 0) {
+        ret = spi_device_acquire_bus(spi, portMAX_DELAY);
+        assert(ret == ESP_OK);
+    }
+}
+
+void ILI9341EndBatch(void) {
+    if ((batch_depth > 0) && (--batch_depth == 0)) {
+        /* The bus can only be released when no transfers of the group are pending */
+        StreamWait();
+        spi_device_release_bus(spi);
+    }
+}
 
-    /* Set coordinates */
-    lcd_x = x;
-    lcd_y = y;
+void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t * font, uint16_t foreground, uint16_t background) {
+    ili9341_text_run_t run = {1, foreground, background};
+    glyph_view_t view;
+    uint16_t lcd_x = x;
+    uint16_t lcd_y = y;
+    char text[2];
+    uint8_t length = 1;
+
+    /* The character is taken as ISO 8859-1, whose codes are the first 256 Unicode code points */
+    if ((uint8_t)data < 0x80) {
+        text[0] = data;
+    } else {
+        text[0] = 0xC0 | ((uint8_t)data >> 6);
+        text[1] = 0x80 | ((uint8_t)data & 0x3F);
+        length = 2;
+    }
 
     /* If at the end of a line of display, go to new line and set x to 0 position */
-    if ((lcd_x + font->FontWidth) > lcd_orientation.width) {
+    GetGlyph(font, (uint8_t)data, &view);
+    if ((lcd_x + view.advance) > lcd_orientation.width) {
         lcd_y += font->FontHeight;
         lcd_x = 0;
     }
+    DrawTextLine(lcd_x, lcd_y, text, length, font, &run, 1, 0, 1);
+}
 
-    SetCursorPosition(lcd_x, lcd_y, lcd_x + font->FontWidth - 1, lcd_y + font->FontHeight - 1);
-
-    /* Number of bytes to write. We have to write 2 bytes/pixel */
-    bytes_count = font->FontHeight * font->FontWidth * 2;
+void ILI9341DrawString(uint16_t x, uint16_t y, char * str, Font_t * font, uint16_t foreground, uint16_t background) {
+    ili9341_text_run_t run = {UINT16_MAX, foreground, background};
 
-    /* Start writing LCD memory */
-    lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
-    WriteLCD(&lcd_write);
+    ILI9341DrawStringRuns(x, y, str, font, &run, 1);
+}
 
-    /* Draw font data */
-    /* go through character rows */
-    k = 0;
-    for (i = 0; i < font->FontHeight; i++) {
-        /* each 16bits data of a font character draws a full row of that character */
-        char_row = font->data[(data - ' ') * font->FontHeight + i];
-        /* go through character columns */
-        for (j = 0; j < font->FontWidth; j++) {
-            /* If exceed buffer size, send buffer */
-            if ((2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE + 1) > MAX_VALUE_SIZE) {
-                lcd_cmd_t lcd_pixels = {SEND_PIXELS, MAX_VALUE_SIZE, pixel};
-                WriteLCD(&lcd_pixels);
-                bytes_count -= MAX_VALUE_SIZE;
-                k++;
-            }
-            /* The n=FontWidth first bits of the 16bits row data draws the corresponding part of a
-             * character */
-            if (char_row & (MSK_BIT16 >> j)) {
-                /* if bit = 1, draw put foreground color */
-                pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE] = HighByte(foreground);
-                pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(foreground);
-            } else {
-                pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE] = HighByte(background);
-                pixel[2 * j + i * font->FontWidth * 2 - k * MAX_VALUE_SIZE + 1] = LowByte(background);
-            }
-        }
-    }
-    /* Send the rest of the buffer */
-    lcd_cmd_t lcd_pixels = {SEND_PIXELS, bytes_count, pixel};
-    WriteLCD(&lcd_pixels);
+void ILI9341DrawStringRuns(uint16_t x, uint16_t y, char * str, Font_t * font, const ili9341_text_run_t * runs,
+                           uint8_t run_count) {
+    DrawText(x, y, str, font, runs, run_count, 1);
 }
 
-void ILI9341DrawString(uint16_t x, uint16_t y, char * str, Font_t * font, uint16_t foreground, uint16_t background) {
-    static uint16_t lcd_x, lcd_y;
+void ILI9341DrawStringScaled(uint16_t x, uint16_t y, char * str, Font_t * font, uint8_t scale, uint16_t foreground,
+                             uint16_t background) {
+    ili9341_text_run_t run = {UINT16_MAX, foreground, background};
 
-    /* Set coordinates */
-    lcd_x = x;
-    lcd_y = y;
+    if (scale < 1) {
+        scale = 1;
+    } else if (scale > TEXT_SCALE_MAX) {
+        scale = TEXT_SCALE_MAX;
+    }
+    DrawText(x, y, str, font, &run, 1, scale);
+}
 
-    while (*str != '\0') /* End of string */
-    {
-        /* New line */
-        if (*str == '\n') {
-            lcd_y += font->FontHeight + 1;
-            /* if after \n is also \r, than go to the left of the screen */
-            if (*(str + 1) == '\r') {
-                lcd_x = 0;
-                str++;
-            } else {
-                lcd_x = x;
-            }
-            str++;
-        } else if (*str == '\r') {
-            str++;
-        }
+void ILI9341GetGlyphCacheStats(ili9341_glyph_cache_stats_t * stats) {
+    *stats = glyph_cache_stats;
+}
 
-        /* Put character to LCD */
-        ILI9341DrawChar(lcd_x, lcd_y, *str, font, foreground, background);
-        /* Next character */
-        str++;
-        lcd_x += font->FontWidth;
-    }
+void ILI9341GetBusStats(ili9341_bus_stats_t * stats) {
+    *stats = bus_stats;
 }
 
 void ILI9341GetStringSize(char * str, Font_t * font, uint16_t * width, uint16_t * height) {
     static uint16_t w;
+    glyph_view_t view;
+    uint16_t length, code, next;
+    uint8_t bytes, next_bytes;
 
     *height = font->FontHeight;
     w = 0;
+    length = strlen(str);
+    code = DecodeUtf8(str, length, &bytes);
     while (*str != '\0') /* End of string */
     {
-        w += font->FontWidth;
-        str++;
+        GetGlyph(font, code, &view);
+        w += view.advance;
+        str += bytes;
+        length -= bytes;
+        if (*str != '\0') {
+            next = DecodeUtf8(str, length, &next_bytes);
+            if (font->kerning_count > 0) {
+                w += GetKerning(font, code, next);
+            }
+            code = next;
+            bytes = next_bytes;
+        }
     }
     *width = w;
 }
@@ -724,35 +1612,315 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
     }
 }
 
+void ILI9341DrawFilledRoundRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t r, uint16_t color) {
+    const uint8_t * width;
+    uint16_t aux;
+
+    if (x0 > x1) {
+        aux = x0;
+        x0 = x1;
+        x1 = aux;
+    }
+    if (y0 > y1) {
+        aux = y0;
+        y0 = y1;
+        y1 = aux;
+    }
+    if (r > (x1 - x0) / 2) {
+        r = (x1 - x0) / 2;
+    }
+    if (r > (y1 - y0) / 2) {
+        r = (y1 - y0) / 2;
+    }
+    if (r > SPAN_MAX_RADIUS) {
+        r = SPAN_MAX_RADIUS;
+    }
+
+    /* Each corner row is a single span joining the left and right corners */
+    width = GetSpanTable(r);
+    for (uint16_t dy = r; dy > 0; dy--) {
+        Fill(x0 + r - width[dy], y0 + r - dy, x1 - r + width[dy], y0 + r - dy, color);
+        Fill(x0 + r - width[dy], y1 - r + dy, x1 - r + width[dy], y1 - r + dy, color);
+    }
+    Fill(x0, y0 + r, x1, y1 - r, color);
+}
+
+void ILI9341DrawRoundRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t r, uint16_t color) {
+    const uint8_t * width;
+    uint16_t aux, inner;
+
+    if (x0 > x1) {
+        aux = x0;
+        x0 = x1;
+        x1 = aux;
+    }
+    if (y0 > y1) {
+        aux = y0;
+        y0 = y1;
+        y1 = aux;
+    }
+    if (r > (x1 - x0) / 2) {
+        r = (x1 - x0) / 2;
+    }
+    if (r > (y1 - y0) / 2) {
+        r = (y1 - y0) / 2;
+    }
+    if (r > SPAN_MAX_RADIUS) {
+        r = SPAN_MAX_RADIUS;
+    }
+
+    /* Top and bottom edges include the flat part of the corners */
+    width = GetSpanTable(r);
+    Fill(x0 + r - width[r], y0, x1 - r + width[r], y0, color);
+    Fill(x0 + r - width[r], y1, x1 - r + width[r], y1, color);
+
+    /* Corner rows only draw the pixels between this row and the next one of the circle, radius 1 has none */
+    if (r > 1) {
+        for (uint16_t dy = r - 1; dy > 0; dy--) {
+            inner = width[dy + 1] + 1;
+            if (inner > width[dy]) {
+                inner = width[dy];
+            }
+            Fill(x0 + r - width[dy], y0 + r - dy, x0 + r - inner, y0 + r - dy, color);
+            Fill(x1 - r + inner, y0 + r - dy, x1 - r + width[dy], y0 + r - dy, color);
+            Fill(x0 + r - width[dy], y1 - r + dy, x0 + r - inner, y1 - r + dy, color);
+            Fill(x1 - r + inner, y1 - r + dy, x1 - r + width[dy], y1 - r + dy, color);
+        }
+    }
+
+    /* Without radius the sides go from the top edge to the bottom one, like a plain rectangle */
+    Fill(x0, y0 + r, x0, y1 - r, color);
+    Fill(x1, y0 + r, x1, y1 - r, color);
+}
+
+void ILI9341DrawArc(int16_t x0, int16_t y0, int16_t r, int16_t thickness, uint16_t start, uint16_t end,
+                    uint16_t color) {
+    const uint8_t * outer;
+    const uint8_t * inner = NULL;
+    int16_t inner_r, dy, dy_from, dy_to, side, from, to, left, right;
+    uint16_t length, angle, piece, quadrant;
+
+    if ((r <= 0) || (thickness <= 0) || (end == start)) {
+        return;
+    }
+    if (r > SPAN_MAX_RADIUS) {
+        r = SPAN_MAX_RADIUS;
+    }
+    length = (end > start) ? end - start : 360 + end - start;
+    if (length > 360) {
+        length = 360;
+    }
+    start = start % 360;
+
+    inner_r = r - thickness;
+    outer = GetSpanTable(r);
+    if (inner_r > 0) {
+        inner = GetSpanTable(inner_r);
+    }
+
+    /* Split the arc in pieces that stay inside one quadrant, where the angle grows monotonically along a row */
+    angle = start;
+    while (length > 0) {
+        quadrant = angle / 90;
+        piece = (quadrant + 1) * 90 - angle;
+        if (piece > length) {
+            piece = length;
+        }
+        side = (quadrant % 4 < 2) ? 1 : -1;
+        if ((quadrant % 4 == 0) || (quadrant % 4 == 3)) {
+            dy_from = -r;
+            dy_to = 0;
+        } else {
+            dy_from = 1;
+            dy_to = r;
+        }
+
+        for (dy = dy_from; dy <= dy_to; dy++) {
+            uint8_t row = (dy < 0) ? -dy : dy;
+
+            /* Annulus on this side of the center */
+            from = (inner && (row <= inner_r)) ? inner[row] + 1 : 0;
+            to = outer[row];
+            if (from > to) {
+                continue;
+            }
+            if (side < 0) {
+                left = -to;
+                to = -from;
+                from = left;
+            }
+
+            /* Sector between both rays */
+            left = RayColumn(dy, angle, r + 1);
+            right = RayColumn(dy, angle + piece, r + 1);
+            if (left > right) {
+                int16_t aux = left;
+                left = right;
+                right = aux;
+            }
+            if (from < left) {
+                from = left;
+            }
+            if (to > right) {
+                to = right;
+            }
+            if (from <= to) {
+                FillSpan(x0 + from, x0 + to, y0 + dy, color);
+            }
+        }
+        angle = (angle + piece) % 360;
+        length -= piece;
+    }
+}
+
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t * pic) {
-    static uint16_t i, j;
-    static int32_t bytes_count;
-    static uint8_t pixel[MAX_VALUE_SIZE];
+    uint32_t bytes_count, chunk;
+    uint8_t * buffer;
 
     SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
     /* Number of bytes to write. We have to write 2 bytes/pixel */
-    bytes_count = width * height * 2;
+    bytes_count = (uint32_t)width * height * 2;
 
     /* Start writing LCD memory */
     lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
     WriteLCD(&lcd_write);
 
-    j = 0;
-    while (bytes_count - MAX_VALUE_SIZE > 0) {
-        for (i = 0; i < MAX_VALUE_SIZE; i++) {
-            pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+    if (esp_ptr_dma_capable(pic) && (((uintptr_t)pic & 3) == 0)) {
+        /* The picture is in internal RAM, the DMA reads it in place */
+        while (bytes_count > 0) {
+            chunk = (bytes_count > STREAM_CHUNK_SIZE) ? STREAM_CHUNK_SIZE : bytes_count;
+            StreamQueue(pic, chunk);
+            pic += chunk;
+            bytes_count -= chunk;
+        }
+        /* The caller owns the picture, it can not be released while the DMA is still reading it */
+        StreamWait();
+    } else {
+        /* The picture is in flash, copy each chunk while the previous one is being sent */
+        while (bytes_count > 0) {
+            chunk = (bytes_count > STREAM_CHUNK_SIZE) ? STREAM_CHUNK_SIZE : bytes_count;
+            buffer = StreamBuffer();
+            memcpy(buffer, pic, chunk);
+            StreamQueue(buffer, chunk);
+            pic += chunk;
+            bytes_count -= chunk;
         }
-        lcd_cmd_t lcd_pixel = {SEND_PIXELS, MAX_VALUE_SIZE, pixel};
-        WriteLCD(&lcd_pixel);
-        bytes_count -= MAX_VALUE_SIZE;
-        j++;
     }
-    for (i = 0; i < bytes_count; i++) {
-        pixel[i] = pic[j * MAX_VALUE_SIZE + i];
+}
+
+void ILI9341DrawCompressedPicture(uint16_t x, uint16_t y, const uint8_t * data) {
+    static rle565_decoder_t decoder;
+
+    if (RLE565DecoderInit(&decoder, data) != 0) {
+        return;
+    }
+    ILI9341DrawGenerated(x, y, decoder.width, decoder.height, DecodeCompressed, &decoder);
+}
+
+void ILI9341DrawGenerated(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ili9341_pixel_source_t source,
+                          void * context) {
+    uint32_t pixels;
+    uint8_t * buffer;
+
+    SetCursorPosition(x, y, x + width - 1, y + height - 1);
+
+    /* Start writing LCD memory */
+    lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+    WriteLCD(&lcd_write);
+
+    /* Each chunk is generated while the previous one is being sent */
+    do {
+        buffer = StreamBuffer();
+        pixels = source(context, buffer, STREAM_CHUNK_SIZE / 2);
+        if (pixels > 0) {
+            StreamQueue(buffer, pixels * 2);
+        }
+    } while (pixels > 0);
+}
+
+void ILI9341DrawSprite(int16_t x, int16_t y, const ili9341_sprite_sheet_t * sheet, uint16_t src_x, uint16_t src_y,
+                       uint16_t width, uint16_t height) {
+    const uint8_t * source;
+    uint8_t * buffer;
+    uint32_t row_bytes, stride, chunk, rows;
+
+    if (!ClipSprite(&x, &y, sheet, &src_x, &src_y, &width, &height)) {
+        return;
+    }
+
+    /* Complete sheet rows are contiguous, so they can be sent as a picture */
+    source = sheet->data + ((uint32_t)src_y * sheet->width + src_x) * 2;
+    if (width == sheet->width) {
+        ILI9341DrawPicture(x, y, width, height, source);
+        return;
+    }
+
+    SetCursorPosition(x, y, x + width - 1, y + height - 1);
+    lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+    WriteLCD(&lcd_write);
+
+    /* Gather as many rows of the source rectangle as fit in each DMA buffer */
+    row_bytes = (uint32_t)width * 2;
+    stride = (uint32_t)sheet->width * 2;
+    while (height > 0) {
+        rows = STREAM_CHUNK_SIZE / row_bytes;
+        if (rows > height) {
+            rows = height;
+        }
+        buffer = StreamBuffer();
+        for (chunk = 0; chunk < rows * row_bytes; chunk += row_bytes) {
+            memcpy(buffer + chunk, source, row_bytes);
+            source += stride;
+        }
+        StreamQueue(buffer, chunk);
+        height -= rows;
+    }
+}
+
+void ILI9341DrawSpriteKeyed(int16_t x, int16_t y, const ili9341_sprite_sheet_t * sheet, uint16_t src_x,
+                            uint16_t src_y, uint16_t width, uint16_t height, uint16_t key) {
+    const uint8_t * source;
+    uint8_t * buffer;
+    uint16_t row, start, end;
+    bool row_set;
+    uint8_t key_high = HighByte(key);
+    uint8_t key_low = LowByte(key);
+
+    if (!ClipSprite(&x, &y, sheet, &src_x, &src_y, &width, &height)) {
+        return;
+    }
+
+    for (row = 0; row < height; row++) {
+        source = sheet->data + ((uint32_t)(src_y + row) * sheet->width + src_x) * 2;
+        row_set = false;
+
+        /* Only the opaque runs of the row are sent, transparent pixels never reach the bus */
+        start = 0;
+        while (start < width) {
+            while ((start < width) && (source[2 * start] == key_high) && (source[2 * start + 1] == key_low)) {
+                start++;
+            }
+            end = start;
+            while ((end < width) && ((source[2 * end] != key_high) || (source[2 * end + 1] != key_low))) {
+                end++;
+            }
+            if (end > start) {
+                /* The copy of this run overlaps the transfer of the previous one */
+                buffer = StreamBuffer();
+                memcpy(buffer, source + 2 * start, (end - start) * 2);
+                if (!row_set) {
+                    SetRows(y + row, y + row);
+                    row_set = true;
+                }
+                SetColumns(x + start, x + end - 1);
+                lcd_cmd_t lcd_write = {MEM_WRITE, 0, NULL};
+                WriteLCD(&lcd_write);
+                StreamQueue(buffer, (end - start) * 2);
+            }
+            start = end;
+        }
     }
-    lcd_cmd_t lcd_pixel = {SEND_PIXELS, bytes_count, pixel};
-    WriteLCD(&lcd_pixel);
 }
 
 /* === End of documentation ==================================================================== */
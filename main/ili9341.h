@@ -108,6 +108,52 @@ typedef enum {
     ILI9341_Landscape_2  /*!< Landscape orientation mode 2 */
 } ili9341_orientation_t;
 
+/**
+ * @brief  Sheet with several sprites in a single picture
+ */
+typedef struct {
+    uint16_t width;       /*!< Sheet width in pixels */
+    uint16_t height;      /*!< Sheet height in pixels */
+    const uint8_t * data; /*!< Pixels row by row, 2 bytes per pixel with the high byte first */
+} ili9341_sprite_sheet_t;
+
+/**
+ * @brief  Colors of a group of consecutive characters in a string
+ */
+typedef struct {
+    uint16_t length;     /*!< Number of characters drawn with these colors */
+    uint16_t foreground; /*!< Color for the characters */
+    uint16_t background; /*!< Color for the characters background */
+} ili9341_text_run_t;
+
+/**
+ * @brief  Counters of the glyph cache used by the text functions
+ */
+typedef struct {
+    uint32_t hits;      /*!< Glyphs found already expanded in the cache */
+    uint32_t misses;    /*!< Glyphs that had to be expanded from the font */
+    uint32_t evictions; /*!< Cached glyphs replaced by the least recently used policy */
+} ili9341_glyph_cache_stats_t;
+
+/**
+ * @brief  Counters of the transfers sent to the LCD
+ */
+typedef struct {
+    uint32_t transactions;    /*!< SPI transactions, polling and queued */
+    uint32_t commands;        /*!< Transactions with a command byte */
+    uint32_t bytes;           /*!< Bytes sent, commands included */
+    uint32_t windows_skipped; /*!< Column or row ranges not sent because the LCD already had them */
+} ili9341_bus_stats_t;
+
+/**
+ * @brief  Function that generates the pixels of a window drawn with @ref ILI9341DrawGenerated
+ * @param[in]  	context: Pointer given to @ref ILI9341DrawGenerated
+ * @param[out] 	buffer: DMA buffer that receives the pixels, 2 bytes per pixel with the high byte first
+ * @param[in]  	pixels: Maximum number of pixels to write in the buffer, at least one LCD row
+ * @retval 		Number of pixels written, 0 when the window is complete
+ */
+typedef uint32_t (*ili9341_pixel_source_t)(void * context, uint8_t * buffer, uint32_t pixels);
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
@@ -140,8 +186,25 @@ void ILI9341Fill(uint16_t color);
  */
 void ILI9341Rotate(ili9341_orientation_t orientation);
 
+/**
+ * @brief  		Starts a group of drawing operations that keeps the SPI bus
+ * @note		The bus is acquired once for the whole group instead of being arbitrated on each transfer. Groups can
+ *				be nested, the bus is released by the outermost @ref ILI9341EndBatch.
+ * @retval 		None
+ */
+void ILI9341BeginBatch(void);
+
+/**
+ * @brief  		Ends a group of drawing operations started with @ref ILI9341BeginBatch
+ * @note		Waits until every queued transfer of the group is sent before releasing the bus
+ * @retval 		None
+ */
+void ILI9341EndBatch(void);
+
 /**
  * @brief  		Draw a single character on the LCD
+ * @note		The character cell is as wide as the glyph advance, characters missing from the font draw a space.
+ *				Codes above 127 are taken as ISO 8859-1, use @ref ILI9341DrawString for other characters.
  * @param[in]  	x: X position of top left corner
  * @param[in]  	y: Y position of top left corner
  * @param[in] 	c: Character to be displayed
@@ -154,6 +217,7 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t * font, uint16_t
 
 /**
  * @brief  		Draw a string on the LCD
+ * @note		The string is UTF-8 encoded, characters missing from the font draw a space
  * @param[in] 	x: X position of top left corner of first character in string
  * @param[in]  	y: Y position of top left corner of first character in string
  * @param[in]  	str: Pointer to first character
@@ -164,8 +228,57 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t * font, uint16_t
  */
 void ILI9341DrawString(uint16_t x, uint16_t y, char * str, Font_t * font, uint16_t foreground, uint16_t background);
 
+/**
+ * @brief  		Draw a string on the LCD with different colors for groups of characters
+ * @note		Each line of the string is sent with a single window, rasterized row by row across all of its
+ *				characters. Characters after the last run keep the colors of the last run.
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	runs: Colors for consecutive groups of characters, line breaks are not counted
+ * @param[in]  	run_count: Number of color runs, at least one
+ * @retval 		None
+ */
+void ILI9341DrawStringRuns(uint16_t x, uint16_t y, char * str, Font_t * font, const ili9341_text_run_t * runs,
+                           uint8_t run_count);
+
+/**
+ * @brief  		Draw a string on the LCD with its font enlarged by an integer factor
+ * @note		Glyph rows are expanded at their original size, widened while copied to the DMA buffer and repeated
+ *				there for each scaled row, so no font table is needed for each size
+ * @param[in] 	x: X position of top left corner of first character in string
+ * @param[in]  	y: Y position of top left corner of first character in string
+ * @param[in]  	str: Pointer to first character
+ * @param[in]  	font: Pointer to used font
+ * @param[in]  	scale: Scale factor, from 1 to 4
+ * @param[in]  	foreground: Color for string
+ * @param[in]  	background: Color for string background
+ * @retval 		None
+ */
+void ILI9341DrawStringScaled(uint16_t x, uint16_t y, char * str, Font_t * font, uint8_t scale, uint16_t foreground,
+                             uint16_t background);
+
+/**
+ * @brief  		Gets the counters of the glyph cache
+ * @note		Glyphs are cached per font, character and colors, already expanded in panel byte order
+ * @param[out]	stats: Pointer to variable to store the counters
+ * @retval 		None
+ */
+void ILI9341GetGlyphCacheStats(ili9341_glyph_cache_stats_t * stats);
+
+/**
+ * @brief  		Gets the counters of the transfers sent to the LCD
+ * @note		The counters only grow, the difference between two reads gives the cost of the drawing in between
+ * @param[out]	stats: Pointer to variable to store the counters
+ * @retval 		None
+ */
+void ILI9341GetBusStats(ili9341_bus_stats_t * stats);
+
 /**
  * @brief  		Gets width and height of box with text
+ * @note		Width adds the advance of each glyph of the UTF-8 string and the kerning between consecutive
+ *				characters
  * @param[in]  	str: Pointer to first character
  * @param[in] 	font: Pointer to used font
  * @param[out]	width: Pointer to variable to store width
@@ -227,8 +340,51 @@ void ILI9341DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
  */
 void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
 
+/**
+ * @brief  		Draws rectangle with rounded corners on the LCD
+ * @param[in]  	x0: X coordinate of top left point
+ * @param[in]  	y0: Y coordinate of top left point
+ * @param[in]  	x1: X coordinate of bottom right point
+ * @param[in]  	y1: Y coordinate of bottom right point
+ * @param[in]  	r: Corner radius
+ * @param[in]  	color: Rectangle color
+ * @retval 		None
+ */
+void ILI9341DrawRoundRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t r, uint16_t color);
+
+/**
+ * @brief  		Draws filled rectangle with rounded corners on the LCD
+ * @note		Corner spans are computed once per radius and kept in a small cache
+ * @param[in]  	x0: X coordinate of top left point
+ * @param[in]  	y0: Y coordinate of top left point
+ * @param[in]  	x1: X coordinate of bottom right point
+ * @param[in]  	y1: Y coordinate of bottom right point
+ * @param[in]  	r: Corner radius
+ * @param[in]  	color: Rectangle color
+ * @retval 		None
+ */
+void ILI9341DrawFilledRoundRectangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t r, uint16_t color);
+
+/**
+ * @brief  		Draws a thick arc segment on the LCD
+ * @note		Angles are in degrees, clockwise from 12 o'clock. The arc goes from start to end clockwise and a
+ *				full ring is drawn when end is start + 360.
+ * @param[in]  	x0: X coordinate of center point
+ * @param[in]  	y0: Y coordinate of center point
+ * @param[in]  	r: Outer radius
+ * @param[in]  	thickness: Width of the arc measured from the outer radius
+ * @param[in]  	start: Start angle
+ * @param[in]  	end: End angle
+ * @param[in]  	color: Arc color
+ * @retval 		None
+ */
+void ILI9341DrawArc(int16_t x0, int16_t y0, int16_t r, int16_t thickness, uint16_t start, uint16_t end,
+                    uint16_t color);
+
 /**
  * @brief  		Draw a picture on the LCD
+ * @note		Pictures in DMA capable RAM aligned to 4 bytes are sent in place, without copies. Pictures in flash
+ *				are copied to double buffers while the previous chunk is sent.
  * @param[in] 	x: X position of top left corner of picture
  * @param[in]  	y: Y position of top left corner of picture
  * @param[in] 	width: Picture width in pixels
@@ -238,6 +394,63 @@ void ILI9341DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
  */
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t hieght, const uint8_t * pic);
 
+/**
+ * @brief  		Draw a compressed picture on the LCD
+ * @note		Pictures are generated with tools/rle565.py, the format is described in rle565.h. Decoding is done
+ *				directly into the DMA buffers while the previous chunk is sent.
+ * @param[in] 	x: X position of top left corner of picture
+ * @param[in]  	y: Y position of top left corner of picture
+ * @param[in]  	data: Pointer to the compressed picture, including its header
+ * @retval 		None
+ */
+void ILI9341DrawCompressedPicture(uint16_t x, uint16_t y, const uint8_t * data);
+
+/**
+ * @brief  		Draw a window whose pixels are generated on the fly
+ * @note		The source writes each chunk directly into the DMA buffers while the previous chunk is sent, so the
+ *				window is drawn with a single address setup and no intermediate copies.
+ * @param[in] 	x: X position of top left corner of the window
+ * @param[in]  	y: Y position of top left corner of the window
+ * @param[in] 	width: Window width in pixels
+ * @param[in]  	height: Window height in pixels
+ * @param[in]  	source: Function that generates the pixels of the window row by row
+ * @param[in]  	context: Pointer passed to each call of the source
+ * @retval 		None
+ */
+void ILI9341DrawGenerated(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ili9341_pixel_source_t source,
+                          void * context);
+
+/**
+ * @brief  		Draw a rectangle of a sprite sheet on the LCD
+ * @note		The sprite is clipped against the sheet and the LCD, so it can be partially outside of the screen
+ * @param[in] 	x: X position of top left corner of the sprite on the LCD
+ * @param[in]  	y: Y position of top left corner of the sprite on the LCD
+ * @param[in]  	sheet: Pointer to the sprite sheet
+ * @param[in] 	src_x: X position of top left corner of the sprite in the sheet
+ * @param[in]  	src_y: Y position of top left corner of the sprite in the sheet
+ * @param[in] 	width: Sprite width in pixels
+ * @param[in]  	height: Sprite height in pixels
+ * @retval 		None
+ */
+void ILI9341DrawSprite(int16_t x, int16_t y, const ili9341_sprite_sheet_t * sheet, uint16_t src_x, uint16_t src_y,
+                       uint16_t width, uint16_t height);
+
+/**
+ * @brief  		Draw a rectangle of a sprite sheet on the LCD with a transparent color
+ * @note		Only the runs of opaque pixels are sent, the LCD keeps its content under transparent pixels
+ * @param[in] 	x: X position of top left corner of the sprite on the LCD
+ * @param[in]  	y: Y position of top left corner of the sprite on the LCD
+ * @param[in]  	sheet: Pointer to the sprite sheet
+ * @param[in] 	src_x: X position of top left corner of the sprite in the sheet
+ * @param[in]  	src_y: Y position of top left corner of the sprite in the sheet
+ * @param[in] 	width: Sprite width in pixels
+ * @param[in]  	height: Sprite height in pixels
+ * @param[in]  	key: Transparent color
+ * @retval 		None
+ */
+void ILI9341DrawSpriteKeyed(int16_t x, int16_t y, const ili9341_sprite_sheet_t * sheet, uint16_t src_x,
+                            uint16_t src_y, uint16_t width, uint16_t height, uint16_t key);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
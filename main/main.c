@@ -1,9 +1,10 @@
-#include <stdio.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "ili9341.h"
 #include "digitos.h"
+#include "etiquetas.h"
+#include "tiempo.h"
 #include "esp_log.h"
 #include "driver/gpio.h"
 #include "button_events.h"    // donde están xButtonEventGroup y los EV_BIT_…
@@ -16,6 +17,13 @@
 #define DIGITO_APAGADO   0x1800
 #define DIGITO_FONDO     ILI9341_BLACK
 
+// Geometría de los dígitos calculada al compilar, compartida por los tres paneles desde la memoria de programa
+static const panel_geometria_t GEOMETRIA_PANELES = GEOMETRIA_DIGITO(DIGITO_ALTO, DIGITO_ANCHO);
+
+// Animación de los minutos y segundos: pasos por cambio y bytes por cuadro, como mucho un dígito completo
+#define ANIMACION_PASOS       6
+#define ANIMACION_PRESUPUESTO (2 * DIGITO_ALTO * DIGITO_ANCHO)
+
 // Definición de offset en mayúsculas
 #define OFFSET_X 10
 
@@ -38,6 +46,9 @@ extern SemaphoreHandle_t semDecimas;
 // Variable global: cada incremento representa 1 décima de segundo (10 ms)
 uint32_t decimas = 0;
 
+// Los mismos 10 ms en digitos decimales, con los dígitos que cambiaron desde el último cuadro dibujado
+tiempo_contador_t contador;
+
 // Definición de una estructura para almacenar el estado actual de los botones
 // Los campos se renombran a "arrancar", "reset" y "congelar"
 typedef struct {
@@ -58,6 +69,12 @@ typedef struct {
 } panel_mt;
 panel_mt PanelPPL;
 
+// Imágenes pre-dibujadas de las centésimas, un dígito de 100x60 ocupa unos 900 bytes
+static uint8_t sprites_decimas[1024];
+
+// Etiquetas para mostrar los tres últimos parciales, solo se redibujan cuando cambian
+etiqueta_t etiquetasParciales[3];
+
 // Tarea que incrementa "decimas" cada 10 ms utilizando vTaskDelayUntil.
 // Si se detecta reset, se reinicia la cuenta.
 // Solo se incrementa si "arrancar" está activo.
@@ -66,10 +83,13 @@ void decimasTask(void *pvParameters) {
     
     while (true) {
         if (xSemaphoreTake(semDecimas, portMAX_DELAY) == pdTRUE) {
-            if (botonesEstado.reset && !botonesEstado.arrancar)
+            if (botonesEstado.reset && !botonesEstado.arrancar) {
                 decimas = 0;
-            else if (botonesEstado.arrancar)
+                TiempoContadorIniciar(&contador, 0);
+            } else if (botonesEstado.arrancar) {
                 decimas++;
+                TiempoContadorAvanzar(&contador);
+            }
             xSemaphoreGive(semDecimas);
         }
         vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(10));
@@ -81,6 +101,9 @@ void displayTask(void *pvParameters) {
     static uint32_t total = 0;
     static uint32_t parciales[4];
     static uint8_t actualizo = 0;
+    static uint8_t digitos[TIEMPO_DIGITOS_MAXIMO];
+    uint8_t cambios;
+    panel_t paneles[] = {PanelPPL.panel_minutes, PanelPPL.panel_seconds, PanelPPL.panel_decimas};
 
     while (1) {
 
@@ -100,38 +123,30 @@ void displayTask(void *pvParameters) {
         }
 
 
-// Obtiene valor de decimas protegido
+// Obtiene valor de decimas protegido, con los dígitos que cambiaron desde la lectura anterior
+        cambios = 0;
         if (xSemaphoreTake(semDecimas, portMAX_DELAY) == pdTRUE) {
-            if (!botonesEstado.congelar)
+            if (!botonesEstado.congelar) {
                 total = decimas;
+                cambios = TiempoContadorLeer(&contador, digitos);
+            }
             xSemaphoreGive(semDecimas);
         }
 
+        // Solo se redibujan los dígitos de minutos, segundos y centésimas que cambiaron, con los dos puntos que se
+        // encienden en los segundos pares. Los cambios de los tres paneles se envían juntos, ordenados en la pantalla
+        AgruparCambios();
+        for (int i = 0; i < TIEMPO_DIGITOS_MAXIMO; i++) {
+            if (cambios & (1 << i)) {
+                DibujarDigito(paneles[i / 2], i % 2, digitos[i]);
+            }
+        }
+        PanelEncenderSeparador(PanelPPL.panel_minutes, 1, (digitos[3] & 1) == 0);
+        PanelEncenderSeparador(PanelPPL.panel_seconds, 1, (digitos[3] & 1) == 0);
+        ConfirmarCambios();
 
-        // Cálculo de tiempo para display
-        uint32_t mins = total / 6000;
-        uint32_t secs = (total / 100) % 60;
-        uint32_t d    = total % 100;
-
-        // Actualiza el panel de minutos (2 dígitos)
-        DibujarDigito(PanelPPL.panel_minutes, 0, mins / 10);
-        DibujarDigito(PanelPPL.panel_minutes, 1, mins % 10);
-
-        // Determina el color de los círculos según la paridad de los segundos
-        uint16_t circleColor = (secs % 2 > 0) ? DIGITO_APAGADO : DIGITO_ENCENDIDO;
-        ILI9341DrawFilledCircle(160 + OFFSET_X, 90 + 20, 5, circleColor);
-        ILI9341DrawFilledCircle(160 + OFFSET_X, 130 + 20, 5, circleColor);
-
-        // Actualiza el panel de segundos (2 dígitos)
-        DibujarDigito(PanelPPL.panel_seconds, 0, secs / 10);
-        DibujarDigito(PanelPPL.panel_seconds, 1, secs % 10);
-
-        ILI9341DrawFilledCircle(300 + OFFSET_X, 90 + 20, 5, circleColor);
-        ILI9341DrawFilledCircle(300 + OFFSET_X, 130 + 20, 5, circleColor);
-
-        // Actualiza el panel de décimas (2 dígitos)
-        DibujarDigito(PanelPPL.panel_decimas, 0, d / 10);
-        DibujarDigito(PanelPPL.panel_decimas, 1, d % 10);
+        // Avanza las transiciones de minutos y segundos con lo que queda del cuadro, después de las centésimas
+        AnimarPaneles(ANIMACION_PRESUPUESTO);
 
         // Carga valores parciales protegidos
         uint32_t local_parciales[3] = {0};
@@ -152,14 +167,10 @@ void displayTask(void *pvParameters) {
             }
 
         // Muestra parciales en pantalla
-        char buf[16];
+        char buf[TIEMPO_TEXTO_MAXIMO];
         for (int i = 0; i < 3; i++) {
-            uint32_t pmin = (local_parciales[i] / 6000) % 100;
-            uint32_t psec = (local_parciales[i] / 100) % 60;
-            uint32_t pde  = local_parciales[i] % 100;
-            snprintf(buf, sizeof(buf), "%02lu:%02lu.%02lu", pmin, psec, pde);
-            ILI9341DrawString(30 + OFFSET_X, 180 + 36 * i, buf, &font_16x26,
-                              ILI9341_WHITE, DIGITO_APAGADO);
+            TiempoTexto(buf, local_parciales[i] * 10, TIEMPO_MM_SS_CC);
+            EscribirEtiqueta(etiquetasParciales[i], buf);
         }
 
         vTaskDelay(pdMS_TO_TICKS(45));
@@ -199,6 +210,7 @@ void toggleTask(void *pvParameters) {
             // resetea el cronómetro a cero de inmediato
             if (xSemaphoreTake(semDecimas, portMAX_DELAY) == pdTRUE ){
                 decimas = 0;
+                TiempoContadorIniciar(&contador, 0);
                 xSemaphoreGive(semDecimas);
             }  
             // y despeja el flag de “congelar”
@@ -259,19 +271,35 @@ void app_main(void) {
         ESP_LOGE("SEM", "Error creando semáforos");
     }
 
+    // El contador arranca en cero con todos sus dígitos pendientes de dibujar
+    TiempoContadorIniciar(&contador, 0);
+
     // Crea paneles de dígitos
-    PanelPPL.panel_minutes = CrearPanel(30 + OFFSET_X, 60, 2,
-                                        DIGITO_ALTO, DIGITO_ANCHO,
-                                        DIGITO_ENCENDIDO, DIGITO_APAGADO,
-                                        DIGITO_FONDO);
-    PanelPPL.panel_seconds = CrearPanel(170 + OFFSET_X, 60, 2,
-                                        DIGITO_ALTO, DIGITO_ANCHO,
-                                        DIGITO_ENCENDIDO, DIGITO_APAGADO,
-                                        DIGITO_FONDO);
-    PanelPPL.panel_decimas = CrearPanel(310 + OFFSET_X, 60, 2,
-                                        DIGITO_ALTO, DIGITO_ANCHO,
-                                        DIGITO_ENCENDIDO, DIGITO_APAGADO,
-                                        DIGITO_FONDO);
+    PanelPPL.panel_minutes = CrearPanelGeometria(30 + OFFSET_X, 60, 2, &GEOMETRIA_PANELES,
+                                                 DIGITO_ENCENDIDO, DIGITO_APAGADO,
+                                                 DIGITO_FONDO);
+    PanelPPL.panel_seconds = CrearPanelGeometria(170 + OFFSET_X, 60, 2, &GEOMETRIA_PANELES,
+                                                 DIGITO_ENCENDIDO, DIGITO_APAGADO,
+                                                 DIGITO_FONDO);
+    PanelPPL.panel_decimas = CrearPanelGeometria(310 + OFFSET_X, 60, 2, &GEOMETRIA_PANELES,
+                                                 DIGITO_ENCENDIDO, DIGITO_APAGADO,
+                                                 DIGITO_FONDO);
+    // Los dos puntos entre minutos, segundos y centésimas son parte de los paneles
+    PanelSeparador(PanelPPL.panel_minutes, 1, SEPARADOR_DOS_PUNTOS);
+    PanelSeparador(PanelPPL.panel_seconds, 1, SEPARADOR_DOS_PUNTOS);
+
+    // Las centésimas cambian en cada actualización, se envían como digitos pre-dibujados
+    PanelPredibujarDigitos(PanelPPL.panel_decimas, sprites_decimas, sizeof(sprites_decimas));
+
+    // Los minutos y segundos ruedan al cambiar, las centésimas no se animan para no atrasarse
+    PanelAnimacion(PanelPPL.panel_minutes, ANIMACION_RODAR, ANIMACION_PASOS);
+    PanelAnimacion(PanelPPL.panel_seconds, ANIMACION_RODAR, ANIMACION_PASOS);
+
+    // Crea etiquetas de parciales
+    for (int i = 0; i < 3; i++) {
+        etiquetasParciales[i] = CrearEtiqueta(30 + OFFSET_X, 180 + 36 * i, &font_16x26_digits,
+                                              ILI9341_WHITE, DIGITO_APAGADO);
+    }
 
     // Configura pines LEDs
     gpio_set_direction(LED_ROJO, GPIO_MODE_OUTPUT);
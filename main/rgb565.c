@@ -0,0 +1,463 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file rgb565.c
+ ** @brief Definiciones de los núcleos de procesamiento de pixeles RGB565 en el orden de bytes del panel
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "rgb565.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Los núcleos de dos pixeles por palabra necesitan un procesador little endian y acceso a palabras con alias
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define RGB565_SWAR 1
+#else
+#define RGB565_SWAR 0
+#endif
+
+//! @brief Máscara de los campos de un color RGB565 separados para poder multiplicarlos en una sola operación
+#define SPREAD_MASK 0x07E0F81FUL
+
+/* === Private data type declarations ============================================================================== */
+
+#if RGB565_SWAR
+//! @brief Palabra de dos pixeles que puede usarse para acceder a cualquier buffer de bytes
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+//! @brief Pixel que puede usarse para acceder a cualquier buffer de bytes
+typedef uint16_t __attribute__((__may_alias__)) half_t;
+#endif
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que separa los campos de un color para mezclarlos con una sola multiplicación
+ *
+ * @param  color    Color RGB565
+ * @return uint32_t Color con el verde en la mitad alta y el rojo y el azul en la mitad baja
+ */
+static inline uint32_t Spread(uint16_t color);
+
+/**
+ * @brief Función que vuelve a juntar los campos de un color separado con @ref Spread
+ *
+ * @param  spread   Color separado
+ * @return uint16_t Color RGB565
+ */
+static inline uint16_t Pack(uint32_t spread);
+
+/**
+ * @brief Función que mezcla dos colores separados con un alfa de 0 a 32
+ *
+ * @param  foreground Color de frente separado
+ * @param  background Color de fondo separado
+ * @param  alpha      Opacidad del color de frente, de 0 a 32
+ * @return uint32_t   Color separado resultante
+ */
+static inline uint32_t BlendSpread(uint32_t foreground, uint32_t background, uint32_t alpha);
+
+/**
+ * @brief Función que expande los niveles de cobertura de a un pixel por vez, a partir del comienzo de un byte
+ *
+ * @param  buffer    Buffer de destino en el orden de bytes del panel, alineado al menos a media palabra
+ * @param  levels    Niveles de cobertura de los pixeles
+ * @param  width     Cantidad de pixeles a escribir
+ * @param  lut       Tabla de mezcla de los niveles
+ * @return uint8_t * Posición del buffer a continuación del último pixel escrito
+ */
+static uint8_t * ExpandLevelsEach(uint8_t * buffer, const uint8_t * levels, uint8_t width,
+                                  const rgb565_blend_lut_t * lut);
+
+#if RGB565_SWAR
+/**
+ * @brief Función que intercambia el orden de bytes de los dos pixeles de una palabra
+ *
+ * @param  word     Palabra con dos pixeles
+ * @return uint32_t Palabra con los bytes de cada pixel intercambiados
+ */
+static inline uint32_t SwapWord(uint32_t word);
+#endif
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static inline uint32_t Spread(uint16_t color) {
+    return (color | ((uint32_t)color << 16)) & SPREAD_MASK;
+}
+
+static inline uint16_t Pack(uint32_t spread) {
+    return (spread & 0xF81F) | ((spread >> 16) & 0x07E0);
+}
+
+static inline uint32_t BlendSpread(uint32_t foreground, uint32_t background, uint32_t alpha) {
+    /* Cada campo tiene lugar para crecer 5 bits sin invadir al siguiente */
+    return ((foreground * alpha + background * (32 - alpha)) >> 5) & SPREAD_MASK;
+}
+
+static uint8_t * ExpandLevelsEach(uint8_t * buffer, const uint8_t * levels, uint8_t width,
+                                  const rgb565_blend_lut_t * lut) {
+    uint8_t mask = (1 << lut->bpp) - 1;
+    uint8_t shift = 8 - lut->bpp;
+
+    for (; width > 0; width--) {
+        memcpy(buffer, &lut->pixels[(*levels >> shift) & mask], 2);
+        buffer += 2;
+        if (shift == 0) {
+            shift = 8 - lut->bpp;
+            levels++;
+        } else {
+            shift -= lut->bpp;
+        }
+    }
+    return buffer;
+}
+
+#if RGB565_SWAR
+static inline uint32_t SwapWord(uint32_t word) {
+    return ((word >> 8) & 0x00FF00FFUL) | ((word << 8) & 0xFF00FF00UL);
+}
+#endif
+
+/* === Public function implementation ============================================================================== */
+
+uint16_t RGB565BlendColor(uint16_t foreground, uint16_t background, uint8_t alpha) {
+    return Pack(BlendSpread(Spread(foreground), Spread(background), (alpha + 4) >> 3));
+}
+
+void RGB565BuildNibbleLut(rgb565_nibble_lut_t * lut, uint16_t foreground, uint16_t background) {
+    uint8_t * pixel;
+
+    lut->foreground = foreground;
+    lut->background = background;
+    for (uint8_t nibble = 0; nibble < 16; nibble++) {
+        pixel = (uint8_t *)lut->pixels[nibble];
+        for (uint8_t bit = 0x08; bit != 0; bit >>= 1) {
+            RGB565FillReference(pixel, (nibble & bit) ? foreground : background, 1);
+            pixel += 2;
+        }
+    }
+}
+
+void RGB565BuildBlendLut(rgb565_blend_lut_t * lut, uint16_t foreground, uint16_t background, uint8_t bpp) {
+    uint8_t max = (1 << bpp) - 1;
+
+    lut->foreground = foreground;
+    lut->background = background;
+    lut->bpp = bpp;
+    for (uint8_t level = 0; level <= max; level++) {
+        RGB565FillReference((uint8_t *)&lut->pixels[level],
+                            RGB565BlendColor(foreground, background, level * RGB565_ALPHA_MAX / max), 1);
+    }
+}
+
+uint8_t * RGB565ExpandLevelsReference(uint8_t * buffer, const uint8_t * levels, uint8_t bpp, uint8_t width,
+                                      uint16_t foreground, uint16_t background) {
+    uint8_t max = (1 << bpp) - 1;
+    uint8_t level;
+
+    for (uint8_t x = 0; x < width; x++) {
+        level = (levels[x * bpp / 8] >> (8 - bpp - (x * bpp) % 8)) & max;
+        RGB565FillReference(buffer, RGB565BlendColor(foreground, background, level * RGB565_ALPHA_MAX / max), 1);
+        buffer += 2;
+    }
+    return buffer;
+}
+
+uint8_t * RGB565ExpandBitsReference(uint8_t * buffer, uint32_t bits, uint8_t width, uint16_t foreground,
+                                    uint16_t background) {
+    for (; width > 0; width--) {
+        RGB565FillReference(buffer, (bits & 0x80000000UL) ? foreground : background, 1);
+        buffer += 2;
+        bits <<= 1;
+    }
+    return buffer;
+}
+
+uint8_t * RGB565ScaleReference(uint8_t * buffer, const uint8_t * source, uint32_t pixels, uint8_t scale) {
+    while (pixels--) {
+        for (uint8_t copy = 0; copy < scale; copy++) {
+            buffer[0] = source[0];
+            buffer[1] = source[1];
+            buffer += 2;
+        }
+        source += 2;
+    }
+    return buffer;
+}
+
+void RGB565FillReference(uint8_t * buffer, uint16_t color, uint32_t pixels) {
+    while (pixels--) {
+        *buffer++ = color >> 8;
+        *buffer++ = color & 0xFF;
+    }
+}
+
+void RGB565SwapReference(uint8_t * buffer, const uint8_t * source, uint32_t pixels) {
+    uint8_t aux;
+
+    while (pixels--) {
+        aux = source[0];
+        buffer[0] = source[1];
+        buffer[1] = aux;
+        buffer += 2;
+        source += 2;
+    }
+}
+
+void RGB565Blend(uint8_t * buffer, const uint8_t * source, uint8_t alpha, uint32_t pixels) {
+    uint16_t color;
+
+    /* De a un pixel, separar y volver a juntar los campos de dos pixeles por palabra cuesta más de lo que ahorra */
+    while (pixels--) {
+        color = RGB565BlendColor((source[0] << 8) | source[1], (buffer[0] << 8) | buffer[1], alpha);
+        buffer[0] = color >> 8;
+        buffer[1] = color & 0xFF;
+        buffer += 2;
+        source += 2;
+    }
+}
+
+void RGB565PaletteExpandReference(uint8_t * buffer, const uint8_t * indexes, const uint16_t * palette,
+                                  uint32_t pixels) {
+    uint16_t color;
+
+    for (uint32_t i = 0; i < pixels; i++) {
+        color = palette[(i & 1) ? (indexes[i / 2] & 0x0F) : (indexes[i / 2] >> 4)];
+        *buffer++ = color >> 8;
+        *buffer++ = color & 0xFF;
+    }
+}
+
+#if RGB565_SWAR
+
+uint8_t * RGB565ExpandBits(uint8_t * buffer, uint32_t bits, uint8_t width, const rgb565_nibble_lut_t * lut) {
+    const uint32_t * pixels;
+
+    /* Glyph widths are not always a multiple of two pixels, so the buffer may be aligned to a half word only */
+    if (((uintptr_t)buffer & 3) == 0) {
+        for (; width >= 4; width -= 4) {
+            pixels = lut->pixels[bits >> 28];
+            ((word_t *)buffer)[0] = pixels[0];
+            ((word_t *)buffer)[1] = pixels[1];
+            buffer += 8;
+            bits <<= 4;
+        }
+    } else if (((uintptr_t)buffer & 1) == 0) {
+        for (; width >= 4; width -= 4) {
+            pixels = lut->pixels[bits >> 28];
+            ((half_t *)buffer)[0] = pixels[0];
+            ((word_t *)(buffer + 2))[0] = (pixels[0] >> 16) | (pixels[1] << 16);
+            ((half_t *)buffer)[3] = pixels[1] >> 16;
+            buffer += 8;
+            bits <<= 4;
+        }
+    }
+    for (; width >= 4; width -= 4) {
+        memcpy(buffer, lut->pixels[bits >> 28], 8);
+        buffer += 8;
+        bits <<= 4;
+    }
+    if (width > 0) {
+        memcpy(buffer, lut->pixels[bits >> 28], width * 2);
+        buffer += width * 2;
+    }
+    return buffer;
+}
+
+void RGB565Fill(uint8_t * buffer, uint16_t color, uint32_t pixels) {
+    uint32_t word;
+    word_t * words;
+
+    if ((uintptr_t)buffer & 1) {
+        RGB565FillReference(buffer, color, pixels);
+        return;
+    }
+    if (((uintptr_t)buffer & 2) && pixels) {
+        RGB565FillReference(buffer, color, 1);
+        buffer += 2;
+        pixels--;
+    }
+
+    word = (color >> 8) | ((color & 0xFF) << 8);
+    word |= word << 16;
+    words = (word_t *)buffer;
+    for (; pixels >= 8; pixels -= 8) {
+        words[0] = word;
+        words[1] = word;
+        words[2] = word;
+        words[3] = word;
+        words += 4;
+    }
+    for (; pixels >= 2; pixels -= 2) {
+        *words++ = word;
+    }
+    RGB565FillReference((uint8_t *)words, color, pixels);
+}
+
+void RGB565Swap(uint8_t * buffer, const uint8_t * source, uint32_t pixels) {
+    word_t * words;
+    const word_t * sources;
+
+    if ((((uintptr_t)buffer ^ (uintptr_t)source) & 3) || ((uintptr_t)buffer & 1)) {
+        RGB565SwapReference(buffer, source, pixels);
+        return;
+    }
+    if (((uintptr_t)buffer & 2) && pixels) {
+        RGB565SwapReference(buffer, source, 1);
+        buffer += 2;
+        source += 2;
+        pixels--;
+    }
+
+    words = (word_t *)buffer;
+    sources = (const word_t *)source;
+    for (; pixels >= 2; pixels -= 2) {
+        *words++ = SwapWord(*sources++);
+    }
+    RGB565SwapReference((uint8_t *)words, (const uint8_t *)sources, pixels);
+}
+
+uint8_t * RGB565ExpandLevels(uint8_t * buffer, const uint8_t * levels, uint8_t width, const rgb565_blend_lut_t * lut) {
+    const uint16_t * pixels = lut->pixels;
+    word_t * words;
+    uint8_t level;
+
+    if ((uintptr_t)buffer & 3) {
+        return ExpandLevelsEach(buffer, levels, width, lut);
+    }
+
+    /* Cada byte de niveles produce una palabra con dos pixeles, o dos palabras con cuatro pixeles */
+    words = (word_t *)buffer;
+    if (lut->bpp == 4) {
+        for (; width >= 2; width -= 2) {
+            level = *levels++;
+            *words++ = pixels[level >> 4] | ((uint32_t)pixels[level & 0x0F] << 16);
+        }
+    } else {
+        for (; width >= 4; width -= 4) {
+            level = *levels++;
+            words[0] = pixels[level >> 6] | ((uint32_t)pixels[(level >> 4) & 0x03] << 16);
+            words[1] = pixels[(level >> 2) & 0x03] | ((uint32_t)pixels[level & 0x03] << 16);
+            words += 2;
+        }
+    }
+    return ExpandLevelsEach((uint8_t *)words, levels, width, lut);
+}
+
+uint8_t * RGB565Scale(uint8_t * buffer, const uint8_t * source, uint32_t pixels, uint8_t scale) {
+    half_t * halves;
+    word_t * words;
+    uint32_t word;
+
+    if (((uintptr_t)buffer | (uintptr_t)source) & 1) {
+        return RGB565ScaleReference(buffer, source, pixels, scale);
+    }
+
+    /* Con factores pares cada pixel de origen llena palabras completas con dos copias */
+    if ((((uintptr_t)buffer & 3) == 0) && ((scale & 1) == 0)) {
+        words = (word_t *)buffer;
+        for (; pixels > 0; pixels--) {
+            word = *(const half_t *)source;
+            word |= word << 16;
+            for (uint8_t copy = 0; copy < scale; copy += 2) {
+                *words++ = word;
+            }
+            source += 2;
+        }
+        return (uint8_t *)words;
+    }
+
+    halves = (half_t *)buffer;
+    for (; pixels > 0; pixels--) {
+        for (uint8_t copy = 0; copy < scale; copy++) {
+            *halves++ = *(const half_t *)source;
+        }
+        source += 2;
+    }
+    return (uint8_t *)halves;
+}
+
+void RGB565PaletteExpand(uint8_t * buffer, const uint8_t * indexes, const uint16_t * palette, uint32_t pixels) {
+    uint16_t colors[RGB565_PALETTE_SIZE];
+    word_t * words;
+
+    if ((uintptr_t)buffer & 3) {
+        RGB565PaletteExpandReference(buffer, indexes, palette, pixels);
+        return;
+    }
+
+    /* Cada byte de indices produce exactamente una palabra con dos pixeles en el orden del panel */
+    for (uint8_t i = 0; i < RGB565_PALETTE_SIZE; i++) {
+        colors[i] = (palette[i] >> 8) | ((palette[i] & 0xFF) << 8);
+    }
+    words = (word_t *)buffer;
+    for (; pixels >= 2; pixels -= 2) {
+        *words++ = colors[*indexes >> 4] | ((uint32_t)colors[*indexes & 0x0F] << 16);
+        indexes++;
+    }
+    RGB565PaletteExpandReference((uint8_t *)words, indexes, palette, pixels);
+}
+
+#else
+
+uint8_t * RGB565ExpandBits(uint8_t * buffer, uint32_t bits, uint8_t width, const rgb565_nibble_lut_t * lut) {
+    for (; width >= 4; width -= 4) {
+        memcpy(buffer, lut->pixels[bits >> 28], 8);
+        buffer += 8;
+        bits <<= 4;
+    }
+    if (width > 0) {
+        memcpy(buffer, lut->pixels[bits >> 28], width * 2);
+        buffer += width * 2;
+    }
+    return buffer;
+}
+
+uint8_t * RGB565ExpandLevels(uint8_t * buffer, const uint8_t * levels, uint8_t width, const rgb565_blend_lut_t * lut) {
+    return ExpandLevelsEach(buffer, levels, width, lut);
+}
+
+uint8_t * RGB565Scale(uint8_t * buffer, const uint8_t * source, uint32_t pixels, uint8_t scale) {
+    return RGB565ScaleReference(buffer, source, pixels, scale);
+}
+
+void RGB565Fill(uint8_t * buffer, uint16_t color, uint32_t pixels) {
+    RGB565FillReference(buffer, color, pixels);
+}
+
+void RGB565Swap(uint8_t * buffer, const uint8_t * source, uint32_t pixels) {
+    RGB565SwapReference(buffer, source, pixels);
+}
+
+void RGB565PaletteExpand(uint8_t * buffer, const uint8_t * indexes, const uint16_t * palette, uint32_t pixels) {
+    RGB565PaletteExpandReference(buffer, indexes, palette, pixels);
+}
+
+#endif
+
+/* === End of documentation ======================================================================================== */
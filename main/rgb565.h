@@ -0,0 +1,211 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef RGB565_H_
+#define RGB565_H_
+
+/** @file rgb565.h
+ ** @brief Declaraciones de los núcleos de procesamiento de pixeles RGB565 en el orden de bytes del panel
+ **
+ ** Los buffers de pixeles usan el orden de bytes que espera el ILI9341 (byte alto primero). Las versiones optimizadas
+ ** procesan dos pixeles por cada palabra de 32 bits y las versiones de referencia procesan un pixel por vez con
+ ** código portable, sirven para verificar y medir las primeras.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ================================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! @brief Valor máximo del canal alfa, equivale a usar solo el color de origen
+#define RGB565_ALPHA_MAX 255
+
+//! @brief Cantidad de colores de una paleta de 4 bits por pixel
+#define RGB565_PALETTE_SIZE 16
+
+/* === Public data type declarations =============================================================================== */
+
+//! @brief Tabla que convierte 4 bits de una fila de un glifo en 4 pixeles en el orden de bytes del panel
+typedef struct rgb565_nibble_lut_s {
+    uint16_t foreground;   //!< Color de los bits en uno con el que se construyó la tabla
+    uint16_t background;   //!< Color de los bits en cero con el que se construyó la tabla
+    uint32_t pixels[16][2]; //!< Cuatro pixeles para cada combinación de bits, el bit más significativo a la izquierda
+} rgb565_nibble_lut_t;
+
+//! @brief Tabla que convierte los niveles de cobertura de un glifo suavizado en pixeles en el orden de bytes del panel
+typedef struct rgb565_blend_lut_s {
+    uint16_t foreground; //!< Color de cobertura completa con el que se construyó la tabla
+    uint16_t background; //!< Color de cobertura nula con el que se construyó la tabla
+    uint8_t bpp;         //!< Bits por pixel de los niveles con los que se construyó la tabla, 2 o 4
+    uint16_t pixels[16]; //!< Pixel en el orden de bytes del panel para cada nivel de cobertura
+} rgb565_blend_lut_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para mezclar dos colores RGB565
+ *
+ * @param  foreground Color de frente
+ * @param  background Color de fondo
+ * @param  alpha      Opacidad del color de frente, de 0 a @ref RGB565_ALPHA_MAX
+ * @return uint16_t   Color resultante de la mezcla
+ */
+uint16_t RGB565BlendColor(uint16_t foreground, uint16_t background, uint8_t alpha);
+
+/**
+ * @brief Función para llenar un buffer con un color constante
+ *
+ * @param buffer Buffer de pixeles en el orden de bytes del panel
+ * @param color  Color de relleno
+ * @param pixels Cantidad de pixeles a escribir
+ */
+void RGB565Fill(uint8_t * buffer, uint16_t color, uint32_t pixels);
+
+/**
+ * @brief Función para intercambiar el orden de bytes de los pixeles entre el del procesador y el del panel
+ *
+ * @param buffer Buffer de destino, puede ser el mismo que el de origen
+ * @param source Buffer de origen
+ * @param pixels Cantidad de pixeles a convertir
+ */
+void RGB565Swap(uint8_t * buffer, const uint8_t * source, uint32_t pixels);
+
+/**
+ * @brief Función para mezclar un buffer de origen sobre un buffer de destino con una opacidad constante
+ *
+ * Mezcla de a un pixel con @ref RGB565BlendColor, no tiene versión de dos pixeles por palabra.
+ *
+ * @param buffer Buffer de destino en el orden de bytes del panel, recibe el resultado
+ * @param source Buffer de origen en el orden de bytes del panel
+ * @param alpha  Opacidad del origen, de 0 a @ref RGB565_ALPHA_MAX
+ * @param pixels Cantidad de pixeles a mezclar
+ */
+void RGB565Blend(uint8_t * buffer, const uint8_t * source, uint8_t alpha, uint32_t pixels);
+
+/**
+ * @brief Función para expandir pixeles de 4 bits por pixel usando una paleta de colores
+ *
+ * @param buffer  Buffer de destino en el orden de bytes del panel
+ * @param indexes Indices de 4 bits, el pixel de la izquierda en el nibble alto de cada byte
+ * @param palette Paleta de @ref RGB565_PALETTE_SIZE colores
+ * @param pixels  Cantidad de pixeles a expandir
+ */
+void RGB565PaletteExpand(uint8_t * buffer, const uint8_t * indexes, const uint16_t * palette, uint32_t pixels);
+
+/**
+ * @brief Función para construir la tabla de expansión de bits para un par de colores
+ *
+ * @param lut        Tabla a construir
+ * @param foreground Color de los bits en uno
+ * @param background Color de los bits en cero
+ */
+void RGB565BuildNibbleLut(rgb565_nibble_lut_t * lut, uint16_t foreground, uint16_t background);
+
+/**
+ * @brief Función para expandir una fila de bits de un glifo a pixeles, de a 4 bits por vez
+ *
+ * @param  buffer    Buffer de destino en el orden de bytes del panel
+ * @param  bits      Bits de la fila alineados a la izquierda, el bit 31 es el primer pixel
+ * @param  width     Cantidad de pixeles a escribir, hasta 32
+ * @param  lut       Tabla construida con @ref RGB565BuildNibbleLut
+ * @return uint8_t * Posición del buffer a continuación del último pixel escrito
+ */
+uint8_t * RGB565ExpandBits(uint8_t * buffer, uint32_t bits, uint8_t width, const rgb565_nibble_lut_t * lut);
+
+/**
+ * @brief Función para construir la tabla de mezcla de niveles de cobertura para un par de colores
+ *
+ * @param lut        Tabla a construir
+ * @param foreground Color de cobertura completa
+ * @param background Color de cobertura nula
+ * @param bpp        Bits por pixel de los niveles de cobertura, 2 o 4
+ */
+void RGB565BuildBlendLut(rgb565_blend_lut_t * lut, uint16_t foreground, uint16_t background, uint8_t bpp);
+
+/**
+ * @brief Función para expandir una fila de niveles de cobertura de un glifo suavizado a pixeles
+ *
+ * @param  buffer    Buffer de destino en el orden de bytes del panel
+ * @param  levels    Niveles de la fila, el pixel de la izquierda en los bits más significativos de cada byte
+ * @param  width     Cantidad de pixeles a escribir
+ * @param  lut       Tabla construida con @ref RGB565BuildBlendLut
+ * @return uint8_t * Posición del buffer a continuación del último pixel escrito
+ */
+uint8_t * RGB565ExpandLevels(uint8_t * buffer, const uint8_t * levels, uint8_t width, const rgb565_blend_lut_t * lut);
+
+/**
+ * @brief Función para ampliar horizontalmente una fila de pixeles repitiendo cada pixel
+ *
+ * @param  buffer    Buffer de destino en el orden de bytes del panel, no puede ser el mismo que el de origen
+ * @param  source    Buffer de origen en el orden de bytes del panel
+ * @param  pixels    Cantidad de pixeles de origen
+ * @param  scale     Cantidad de veces que se repite cada pixel
+ * @return uint8_t * Posición del buffer a continuación del último pixel escrito
+ */
+uint8_t * RGB565Scale(uint8_t * buffer, const uint8_t * source, uint32_t pixels, uint8_t scale);
+
+/**
+ * @brief Versión de referencia de @ref RGB565ExpandBits, evalúa los bits de a uno
+ */
+uint8_t * RGB565ExpandBitsReference(uint8_t * buffer, uint32_t bits, uint8_t width, uint16_t foreground,
+                                    uint16_t background);
+
+/**
+ * @brief Versión de referencia de @ref RGB565ExpandLevels, mezcla los colores de cada pixel
+ */
+uint8_t * RGB565ExpandLevelsReference(uint8_t * buffer, const uint8_t * levels, uint8_t bpp, uint8_t width,
+                                      uint16_t foreground, uint16_t background);
+
+/**
+ * @brief Versión de referencia de @ref RGB565Scale
+ */
+uint8_t * RGB565ScaleReference(uint8_t * buffer, const uint8_t * source, uint32_t pixels, uint8_t scale);
+
+/**
+ * @brief Versión de referencia de @ref RGB565Fill
+ */
+void RGB565FillReference(uint8_t * buffer, uint16_t color, uint32_t pixels);
+
+/**
+ * @brief Versión de referencia de @ref RGB565Swap
+ */
+void RGB565SwapReference(uint8_t * buffer, const uint8_t * source, uint32_t pixels);
+
+/**
+ * @brief Versión de referencia de @ref RGB565PaletteExpand
+ */
+void RGB565PaletteExpandReference(uint8_t * buffer, const uint8_t * indexes, const uint16_t * palette,
+                                  uint32_t pixels);
+
+/* === End of documentation ======================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RGB565_H_ */
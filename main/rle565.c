@@ -0,0 +1,144 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file rle565.c
+ ** @brief Definiciones del decodificador de imagenes RGB565 comprimidas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "rle565.h"
+#include "rgb565.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define OP_MASK     0xC0 //!< Bits que indican el tipo de un código
+#define OP_RUN      0x00 //!< Código de repetición corta
+#define OP_INDEX    0x40 //!< Código de color de la tabla
+#define OP_DIFF     0x80 //!< Código de diferencia con el pixel anterior
+#define OP_LONG     0xE0 //!< Código de repetición larga, se distingue del literal por el bit 5
+#define OP_LITERALS 0xC0 //!< Código de pixeles sin comprimir
+#define LONG_RUN    65   //!< Repeticiones mínimas de un código de repetición larga
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que guarda un pixel decodificado como pixel anterior y en la tabla de colores recientes
+ *
+ * @param decoder Estado del decodificador
+ * @param color   Pixel decodificado
+ */
+static inline void Remember(rle565_decoder_t * decoder, uint16_t color);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static inline void Remember(rle565_decoder_t * decoder, uint16_t color) {
+    decoder->previous = color;
+    decoder->table[RLE565_HASH(color)] = color;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int RLE565DecoderInit(rle565_decoder_t * decoder, const uint8_t * data) {
+    if ((data[0] != 'R') || (data[1] != '5')) {
+        return -1;
+    }
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->width = (data[2] << 8) | data[3];
+    decoder->height = (data[4] << 8) | data[5];
+    decoder->remaining = (uint32_t)decoder->width * decoder->height;
+    decoder->data = data + RLE565_HEADER_SIZE;
+    return 0;
+}
+
+uint32_t RLE565Decode(rle565_decoder_t * decoder, uint8_t * buffer, uint32_t pixels) {
+    uint32_t written = 0;
+    uint32_t count;
+    uint16_t color;
+    uint8_t code;
+
+    if (pixels > decoder->remaining) {
+        pixels = decoder->remaining;
+    }
+
+    while (written < pixels) {
+        /* Pending repetitions and literals may come from a previous call */
+        if (decoder->run > 0) {
+            count = (decoder->run < pixels - written) ? decoder->run : pixels - written;
+            RGB565Fill(buffer, decoder->previous, count);
+            buffer += 2 * count;
+            written += count;
+            decoder->run -= count;
+            continue;
+        }
+        if (decoder->literals > 0) {
+            count = (decoder->literals < pixels - written) ? decoder->literals : pixels - written;
+            memcpy(buffer, decoder->data, 2 * count);
+            for (uint32_t i = 0; i < count; i++) {
+                Remember(decoder, (decoder->data[0] << 8) | decoder->data[1]);
+                decoder->data += 2;
+            }
+            buffer += 2 * count;
+            written += count;
+            decoder->literals -= count;
+            continue;
+        }
+
+        code = *decoder->data++;
+        switch (code & OP_MASK) {
+        case OP_RUN:
+            decoder->run = (code & 0x3F) + 1;
+            continue;
+        case OP_INDEX:
+            color = decoder->table[code & 0x3F];
+            break;
+        case OP_DIFF:
+            color = decoder->previous;
+            color = (((color >> 11) + ((code >> 4) & 0x03) - 2) & 0x1F) << 11 |
+                    ((((color >> 5) & 0x3F) + ((code >> 2) & 0x03) - 2) & 0x3F) << 5 |
+                    (((color & 0x1F) + (code & 0x03) - 2) & 0x1F);
+            break;
+        default:
+            if ((code & OP_LONG) == OP_LONG) {
+                decoder->run = LONG_RUN + ((code & 0x1F) << 8) + *decoder->data++;
+            } else {
+                decoder->literals = (code & 0x1F) + 1;
+            }
+            continue;
+        }
+        Remember(decoder, color);
+        *buffer++ = color >> 8;
+        *buffer++ = color & 0xFF;
+        written++;
+    }
+
+    decoder->remaining -= written;
+    return written;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef RLE565_H_
+#define RLE565_H_
+
+/** @file rle565.h
+ ** @brief Declaraciones del decodificador de imagenes RGB565 comprimidas
+ **
+ ** Las imagenes se generan con tools/rle565.py. Empiezan con una cabecera de 6 bytes: la firma 'R' '5' y el ancho y
+ ** el alto en pixeles, ambos de 16 bits con el byte alto primero. Luego sigue una secuencia de códigos, cada uno
+ ** empieza con un byte cuyos bits altos indican su tipo:
+ **
+ ** | Byte       | Significado                                                                            |
+ ** |:-----------|:---------------------------------------------------------------------------------------|
+ ** | `00nnnnnn` | Repite n + 1 veces el pixel anterior                                                   |
+ ** | `01iiiiii` | Usa el color guardado en la posición i de la tabla de colores recientes                |
+ ** | `10rrggbb` | Suma a cada campo del pixel anterior una diferencia entre -2 y 1, con desplazamiento 2 |
+ ** | `110nnnnn` | Siguen n + 1 pixeles sin comprimir, de 2 bytes con el byte alto primero                |
+ ** | `111nnnnn` | Repite el pixel anterior 65 + n * 256 + el valor del byte siguiente veces              |
+ **
+ ** Cada pixel generado por los códigos de tabla, diferencia o literal se guarda en la tabla de colores recientes en la
+ ** posición que indica @ref RLE565_HASH. Al comenzar el pixel anterior es negro y la tabla está en cero.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ================================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! @brief Cantidad de bytes de la cabecera de una imagen comprimida
+#define RLE565_HEADER_SIZE 6
+
+//! @brief Cantidad de entradas de la tabla de colores recientes
+#define RLE565_TABLE_SIZE 64
+
+//! @brief Posición de un color en la tabla de colores recientes
+#define RLE565_HASH(color)                                                                                             \
+    ((((color) >> 11) * 3 + (((color) >> 5) & 0x3F) * 5 + ((color)&0x1F) * 7) & (RLE565_TABLE_SIZE - 1))
+
+/* === Public data type declarations =============================================================================== */
+
+//! @brief Estado de un decodificador, permite decodificar una imagen por partes
+typedef struct rle565_decoder_s {
+    const uint8_t * data;                //!< Próximo código a decodificar
+    uint16_t width;                      //!< Ancho de la imagen en pixeles
+    uint16_t height;                     //!< Alto de la imagen en pixeles
+    uint32_t remaining;                  //!< Cantidad de pixeles que falta decodificar
+    uint16_t previous;                   //!< Último pixel decodificado
+    uint16_t run;                        //!< Repeticiones pendientes del último pixel
+    uint8_t literals;                    //!< Pixeles sin comprimir pendientes
+    uint16_t table[RLE565_TABLE_SIZE];   //!< Tabla de colores recientes
+} rle565_decoder_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para preparar un decodificador para una imagen comprimida
+ *
+ * @param  decoder Estado del decodificador
+ * @param  data    Imagen comprimida, empezando por la cabecera
+ * @return int     0 si la imagen es válida, -1 si la cabecera no es correcta
+ */
+int RLE565DecoderInit(rle565_decoder_t * decoder, const uint8_t * data);
+
+/**
+ * @brief Función para decodificar la siguiente parte de una imagen
+ *
+ * @param  decoder  Estado del decodificador
+ * @param  buffer   Buffer que recibe los pixeles en el orden de bytes del panel
+ * @param  pixels   Cantidad máxima de pixeles a escribir en el buffer
+ * @return uint32_t Cantidad de pixeles escritos, 0 cuando la imagen está completa
+ */
+uint32_t RLE565Decode(rle565_decoder_t * decoder, uint8_t * buffer, uint32_t pixels);
+
+/* === End of documentation ======================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RLE565_H_ */
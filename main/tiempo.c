@@ -0,0 +1,164 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file tiempo.c
+ ** @brief Definiciones de la biblioteca para dar formato a tiempos sin usar stdio ni divisiones
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "tiempo.h"
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Cociente de un entero de 32 bits por 1000, multiplicando por el recíproco redondeado hacia arriba
+#define DIVIDIR_1000(valor) ((uint32_t)(((uint64_t)(valor) * 0x10624DD3UL) >> 38))
+
+//! @brief Cociente de un entero de 32 bits por 60, multiplicando por el recíproco redondeado hacia arriba
+#define DIVIDIR_60(valor) ((uint32_t)(((uint64_t)(valor) * 0x88888889UL) >> 37))
+
+//! @brief Cociente de un entero de 32 bits por 100, multiplicando por el recíproco redondeado hacia arriba
+#define DIVIDIR_100(valor) ((uint32_t)(((uint64_t)(valor) * 0x51EB851FUL) >> 37))
+
+//! @brief Cociente por 10 de un valor menor a 1029, con una multiplicación y un desplazamiento
+#define DECENAS(valor) (((uint32_t)(valor) * 205) >> 11)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private variable declarations =============================================================================== */
+
+//! @brief Valor máximo de cada digito de un contador, en el formato @ref TIEMPO_MM_SS_CC
+static const uint8_t LIMITES[TIEMPO_DIGITOS_MAXIMO] = {9, 9, 5, 9, 9, 9};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que escribe los dos digitos de un valor menor a 100
+ *
+ * @param  digitos   Destino de los digitos
+ * @param  valor     Valor de 0 a 99
+ * @return uint8_t * Posición siguiente al último digito escrito
+ */
+static uint8_t * DosDigitos(uint8_t * digitos, uint32_t valor);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t * DosDigitos(uint8_t * digitos, uint32_t valor) {
+    uint32_t decenas = DECENAS(valor);
+
+    digitos[0] = decenas;
+    digitos[1] = valor - decenas * 10;
+    return digitos + 2;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void TiempoSeparar(tiempo_t * tiempo, uint32_t milisegundos) {
+    uint32_t segundos = DIVIDIR_1000(milisegundos);
+    uint32_t minutos = DIVIDIR_60(segundos);
+    uint32_t horas = DIVIDIR_60(minutos);
+
+    tiempo->milisegundos = milisegundos - segundos * 1000;
+    tiempo->segundos = segundos - minutos * 60;
+    tiempo->minutos = minutos - horas * 60;
+    tiempo->horas = horas;
+}
+
+uint8_t TiempoDigitos(uint8_t * digitos, uint32_t milisegundos, tiempo_formato_t formato) {
+    uint8_t * digito = digitos;
+    uint32_t minutos, centesimas;
+    tiempo_t tiempo;
+
+    TiempoSeparar(&tiempo, milisegundos);
+    switch (formato) {
+    case TIEMPO_MM_SS_CC:
+        minutos = tiempo.horas * 60 + tiempo.minutos;
+        centesimas = DECENAS(tiempo.milisegundos);
+        digito = DosDigitos(digito, minutos - DIVIDIR_100(minutos) * 100);
+        digito = DosDigitos(digito, tiempo.segundos);
+        digito = DosDigitos(digito, centesimas);
+        break;
+
+    case TIEMPO_HH_MM_SS:
+        digito = DosDigitos(digito, tiempo.horas - DIVIDIR_100(tiempo.horas) * 100);
+        digito = DosDigitos(digito, tiempo.minutos);
+        digito = DosDigitos(digito, tiempo.segundos);
+        break;
+
+    case TIEMPO_SS_MMM:
+        digito = DosDigitos(digito, tiempo.segundos);
+        *digito++ = DIVIDIR_100(tiempo.milisegundos);
+        digito = DosDigitos(digito, tiempo.milisegundos - DIVIDIR_100(tiempo.milisegundos) * 100);
+        break;
+    }
+    return digito - digitos;
+}
+
+uint8_t TiempoTexto(char * texto, uint32_t milisegundos, tiempo_formato_t formato) {
+    static const char SEPARADORES[][TIEMPO_DIGITOS_MAXIMO] = {
+        [TIEMPO_MM_SS_CC] = {0, 0, ':', 0, '.', 0},
+        [TIEMPO_HH_MM_SS] = {0, 0, ':', 0, ':', 0},
+        [TIEMPO_SS_MMM] = {0, 0, '.', 0, 0, 0},
+    };
+    uint8_t digitos[TIEMPO_DIGITOS_MAXIMO];
+    uint8_t cantidad = TiempoDigitos(digitos, milisegundos, formato);
+    uint8_t largo = 0;
+
+    for (uint8_t indice = 0; indice < cantidad; indice++) {
+        if (SEPARADORES[formato][indice] != 0) {
+            texto[largo++] = SEPARADORES[formato][indice];
+        }
+        texto[largo++] = '0' + digitos[indice];
+    }
+    texto[largo] = '\0';
+    return largo;
+}
+
+void TiempoContadorIniciar(tiempo_contador_t * contador, uint32_t centesimas) {
+    TiempoDigitos(contador->digitos, centesimas * 10, TIEMPO_MM_SS_CC);
+    contador->cambios = (1 << TIEMPO_DIGITOS_MAXIMO) - 1;
+}
+
+void TiempoContadorAvanzar(tiempo_contador_t * contador) {
+    /* Cada digito que pasa su máximo vuelve a cero y lleva el acarreo al digito de la izquierda */
+    for (int8_t indice = TIEMPO_DIGITOS_MAXIMO - 1; indice >= 0; indice--) {
+        contador->cambios |= 1 << indice;
+        if (contador->digitos[indice] < LIMITES[indice]) {
+            contador->digitos[indice]++;
+            return;
+        }
+        contador->digitos[indice] = 0;
+    }
+}
+
+uint8_t TiempoContadorLeer(tiempo_contador_t * contador, uint8_t * digitos) {
+    uint8_t cambios = contador->cambios;
+
+    for (uint8_t indice = 0; indice < TIEMPO_DIGITOS_MAXIMO; indice++) {
+        digitos[indice] = contador->digitos[indice];
+    }
+    contador->cambios = 0;
+    return cambios;
+}
+
+/* === End of documentation ======================================================================================== */
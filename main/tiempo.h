@@ -0,0 +1,137 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TIEMPO_H_
+#define TIEMPO_H_
+
+/** @file tiempo.h
+ ** @brief Declaraciones de la biblioteca para dar formato a tiempos sin usar stdio ni divisiones
+ **
+ ** Las funciones no usan memoria dinámica ni variables estáticas, por lo que se pueden llamar desde interrupciones y
+ ** desde varias tareas al mismo tiempo. Las divisiones por constantes se reemplazan por multiplicaciones por el
+ ** recíproco, exactas para todo el rango de un entero de 32 bits.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ================================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! @brief Cantidad máxima de digitos que genera un formato
+#define TIEMPO_DIGITOS_MAXIMO 6
+
+//! @brief Tamaño del texto más largo que genera un formato, incluyendo el terminador
+#define TIEMPO_TEXTO_MAXIMO 9
+
+/* === Public data type declarations =============================================================================== */
+
+//! @brief Formatos de presentación de un tiempo, los campos que no entran se descartan por la izquierda
+typedef enum tiempo_formato_e {
+    TIEMPO_MM_SS_CC, //!< Minutos, segundos y centésimas, por ejemplo "07:45.12"
+    TIEMPO_HH_MM_SS, //!< Horas, minutos y segundos, por ejemplo "01:07:45"
+    TIEMPO_SS_MMM,   //!< Segundos y milisegundos, por ejemplo "45.123"
+} tiempo_formato_t;
+
+//! @brief Tiempo separado en sus campos
+typedef struct tiempo_s {
+    uint32_t horas;        //!< Horas completas
+    uint8_t minutos;       //!< Minutos, de 0 a 59
+    uint8_t segundos;      //!< Segundos, de 0 a 59
+    uint16_t milisegundos; //!< Milisegundos, de 0 a 999
+} tiempo_t;
+
+//! @brief Contador incremental de minutos, segundos y centésimas, con un digito decimal por byte
+typedef struct tiempo_contador_s {
+    uint8_t digitos[TIEMPO_DIGITOS_MAXIMO]; //!< Digitos en formato @ref TIEMPO_MM_SS_CC, el más significativo primero
+    uint8_t cambios;                        //!< Digitos que cambiaron desde la última lectura, el bit n por el digito n
+} tiempo_contador_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para separar un tiempo en milisegundos en horas, minutos, segundos y milisegundos
+ *
+ * @param tiempo       Tiempo separado en sus campos
+ * @param milisegundos Tiempo en milisegundos
+ */
+void TiempoSeparar(tiempo_t * tiempo, uint32_t milisegundos);
+
+/**
+ * @brief Función para obtener los digitos de un tiempo en un formato, sin los separadores
+ *
+ * @param  digitos      Valores de 0 a 9 de cada digito, el más significativo primero
+ * @param  milisegundos Tiempo en milisegundos
+ * @param  formato      Formato de presentación
+ * @return uint8_t      Cantidad de digitos escritos, como máximo @ref TIEMPO_DIGITOS_MAXIMO
+ */
+uint8_t TiempoDigitos(uint8_t * digitos, uint32_t milisegundos, tiempo_formato_t formato);
+
+/**
+ * @brief Función para obtener el texto de un tiempo en un formato, con ancho fijo y los separadores
+ *
+ * @param  texto        Texto terminado en cero, con lugar para @ref TIEMPO_TEXTO_MAXIMO caracteres
+ * @param  milisegundos Tiempo en milisegundos
+ * @param  formato      Formato de presentación
+ * @return uint8_t      Cantidad de caracteres escritos, sin contar el terminador
+ */
+uint8_t TiempoTexto(char * texto, uint32_t milisegundos, tiempo_formato_t formato);
+
+/**
+ * @brief Función para poner un contador en un tiempo, marcando todos sus digitos como cambiados
+ *
+ * @param contador   Contador que se desea iniciar
+ * @param centesimas Tiempo inicial en centésimas de segundo
+ */
+void TiempoContadorIniciar(tiempo_contador_t * contador, uint32_t centesimas);
+
+/**
+ * @brief Función para avanzar un contador en una centésima de segundo
+ *
+ * El contador avanza digito por digito con acarreo, sin divisiones, y marca los digitos que cambian. Después de 99
+ * minutos, 59 segundos y 99 centésimas vuelve a cero.
+ *
+ * @param contador   Contador que se desea avanzar
+ */
+void TiempoContadorAvanzar(tiempo_contador_t * contador);
+
+/**
+ * @brief Función para leer los digitos de un contador y los que cambiaron desde la lectura anterior
+ *
+ * @param  contador Contador que se desea leer, sus cambios quedan en cero
+ * @param  digitos  Destino de los @ref TIEMPO_DIGITOS_MAXIMO digitos del contador
+ * @return uint8_t  Digitos que cambiaron desde la lectura anterior, el bit n en uno si cambió el digito n
+ */
+uint8_t TiempoContadorLeer(tiempo_contador_t * contador, uint8_t * digitos);
+
+/* === End of documentation ======================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIEMPO_H_ */
@@ -0,0 +1,220 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file benchmark_rgb565.c
+ ** @brief Medición de los pixeles por segundo de cada núcleo RGB565 y de su versión de referencia
+ **
+ ** Cada núcleo procesa una fila de la pantalla horizontal por llamada, con buffers alineados a palabra como los buffers
+ ** DMA del controlador. El resultado se compara con la cantidad de pixeles por segundo que puede enviar el bus SPI: un
+ ** núcleo que la supera no limita la velocidad de dibujo.
+ **
+ ** La expansión de glifos dibuja una fila de texto como lo hace ILI9341DrawString: una llamada por fila de cada glifo,
+ ** con los anchos de las fuentes de la aplicación.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "prueba.h"
+#include "rgb565.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Pixeles procesados en cada llamada a un núcleo, una fila de la pantalla horizontal
+#define PIXELES 320
+
+//! @brief Tiempo que se mide cada núcleo, en segundos
+#define DURACION 0.2
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Núcleo a medir con sus argumentos ya fijados, devuelve la cantidad de pixeles que procesó
+typedef uint32_t (*nucleo_t)(void);
+
+//! @brief Par de versiones de un núcleo
+typedef struct medicion_s {
+    const char * nombre;  //!< Nombre del núcleo
+    nucleo_t referencia;  //!< Versión de referencia, de a un pixel
+    nucleo_t optimizado;  //!< Versión de dos pixeles por palabra
+    uint8_t * resultado;  //!< Buffer que escriben las dos versiones, para comparar sus salidas
+} medicion_t;
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t origen[PIXELES * 2] __attribute__((aligned(4)));
+
+static uint8_t destino[PIXELES * 2] __attribute__((aligned(4)));
+
+static uint8_t indices[PIXELES / 2] __attribute__((aligned(4)));
+
+static uint16_t paleta[RGB565_PALETTE_SIZE];
+
+static uint32_t filas[PIXELES];
+
+static rgb565_nibble_lut_t nibbles;
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t FillReferencia(void) {
+    RGB565FillReference(destino, 0xF81F, PIXELES);
+    return PIXELES;
+}
+
+static uint32_t FillOptimizado(void) {
+    RGB565Fill(destino, 0xF81F, PIXELES);
+    return PIXELES;
+}
+
+static uint32_t SwapReferencia(void) {
+    RGB565SwapReference(destino, origen, PIXELES);
+    return PIXELES;
+}
+
+static uint32_t SwapOptimizado(void) {
+    RGB565Swap(destino, origen, PIXELES);
+    return PIXELES;
+}
+
+static uint32_t PaletaReferencia(void) {
+    RGB565PaletteExpandReference(destino, indices, paleta, PIXELES);
+    return PIXELES;
+}
+
+static uint32_t PaletaOptimizado(void) {
+    RGB565PaletteExpand(destino, indices, paleta, PIXELES);
+    return PIXELES;
+}
+
+static uint32_t ScaleReferencia(void) {
+    RGB565ScaleReference(destino, origen, PIXELES / 2, 2);
+    return PIXELES;
+}
+
+static uint32_t ScaleOptimizado(void) {
+    RGB565Scale(destino, origen, PIXELES / 2, 2);
+    return PIXELES;
+}
+
+static uint32_t ExpandirReferencia(uint8_t ancho) {
+    uint8_t * pixel = destino;
+
+    for (uint32_t glifo = 0; glifo < PIXELES / ancho; glifo++) {
+        pixel = RGB565ExpandBitsReference(pixel, filas[glifo], ancho, 0xFFE0, 0x0010);
+    }
+    return pixel - destino;
+}
+
+static uint32_t ExpandirOptimizado(uint8_t ancho) {
+    uint8_t * pixel = destino;
+
+    for (uint32_t glifo = 0; glifo < PIXELES / ancho; glifo++) {
+        pixel = RGB565ExpandBits(pixel, filas[glifo], ancho, &nibbles);
+    }
+    return pixel - destino;
+}
+
+static uint32_t Expandir7Referencia(void) {
+    return ExpandirReferencia(7) / 2;
+}
+
+static uint32_t Expandir7Optimizado(void) {
+    return ExpandirOptimizado(7) / 2;
+}
+
+static uint32_t Expandir11Referencia(void) {
+    return ExpandirReferencia(11) / 2;
+}
+
+static uint32_t Expandir11Optimizado(void) {
+    return ExpandirOptimizado(11) / 2;
+}
+
+static uint32_t Expandir16Referencia(void) {
+    return ExpandirReferencia(16) / 2;
+}
+
+static uint32_t Expandir16Optimizado(void) {
+    return ExpandirOptimizado(16) / 2;
+}
+
+static double Medir(nucleo_t nucleo) {
+    double comienzo = Segundos(), transcurrido;
+    uint64_t pixeles = 0;
+
+    do {
+        for (int vuelta = 0; vuelta < 64; vuelta++) {
+            pixeles += nucleo();
+        }
+        transcurrido = Segundos() - comienzo;
+    } while (transcurrido < DURACION);
+    return pixeles / transcurrido;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const medicion_t MEDICIONES[] = {
+        {"RGB565Fill", FillReferencia, FillOptimizado, destino},
+        {"RGB565Swap", SwapReferencia, SwapOptimizado, destino},
+        {"RGB565PaletteExpand", PaletaReferencia, PaletaOptimizado, destino},
+        {"RGB565Scale x2", ScaleReferencia, ScaleOptimizado, destino},
+        {"RGB565ExpandBits 7px", Expandir7Referencia, Expandir7Optimizado, destino},
+        {"RGB565ExpandBits 11px", Expandir11Referencia, Expandir11Optimizado, destino},
+        {"RGB565ExpandBits 16px", Expandir16Referencia, Expandir16Optimizado, destino},
+    };
+    static uint8_t esperado[sizeof(destino)];
+    const double bus = SPI_BYTES_POR_SEGUNDO / 2;
+    double referencia, optimizado;
+
+    srand(565);
+    for (uint32_t indice = 0; indice < sizeof(origen); indice++) {
+        origen[indice] = rand();
+    }
+    for (uint32_t indice = 0; indice < sizeof(indices); indice++) {
+        indices[indice] = rand();
+    }
+    for (uint32_t indice = 0; indice < RGB565_PALETTE_SIZE; indice++) {
+        paleta[indice] = rand();
+    }
+    for (uint32_t indice = 0; indice < PIXELES; indice++) {
+        filas[indice] = ((uint32_t)rand() << 16) ^ rand();
+    }
+    RGB565BuildNibbleLut(&nibbles, 0xFFE0, 0x0010);
+
+    printf("Bus SPI: %.2f Mpixeles/s\n", bus / 1e6);
+    printf("%-22s %16s %16s %8s %12s\n", "núcleo", "referencia Mpx/s", "optimizado Mpx/s", "mejora", "veces el bus");
+    for (uint32_t indice = 0; indice < sizeof(MEDICIONES) / sizeof(MEDICIONES[0]); indice++) {
+        const medicion_t * medicion = &MEDICIONES[indice];
+
+        medicion->referencia();
+        memcpy(esperado, medicion->resultado, sizeof(esperado));
+        medicion->optimizado();
+        VERIFICAR(memcmp(esperado, medicion->resultado, sizeof(esperado)) == 0, "%s: las versiones no coinciden",
+                  medicion->nombre);
+
+        referencia = Medir(medicion->referencia);
+        optimizado = Medir(medicion->optimizado);
+        printf("%-22s %16.1f %16.1f %7.2fx %11.1fx\n", medicion->nombre, referencia / 1e6, optimizado / 1e6,
+               optimizado / referencia, optimizado / bus);
+    }
+    return Terminar("benchmark_rgb565");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,88 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file benchmark_rle565.c
+ ** @brief Medición de la velocidad del decodificador RLE565 comparada con la del bus SPI
+ **
+ ** ILI9341DrawCompressedPicture decodifica en los buffers DMA mientras se envía el anterior, así que el dibujo solo
+ ** queda limitado por el bus si el decodificador produce bytes más rápido de lo que el bus los envía.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "imagenes.h"
+#include "prueba.h"
+#include "rle565.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Pixeles de cada parte, los de un buffer DMA del controlador (STREAM_CHUNK_SIZE de ili9341.c)
+#define PIXELES_PARTE (16 * 320)
+
+//! @brief Tiempo que se mide cada imagen, en segundos
+#define DURACION 0.2
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t buffer[PIXELES_PARTE * 2] __attribute__((aligned(4)));
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Decodificar(const uint8_t * datos, uint32_t * comprimidos) {
+    rle565_decoder_t decodificador;
+    uint32_t pixeles = 0, escritos;
+
+    RLE565DecoderInit(&decodificador, datos);
+    while ((escritos = RLE565Decode(&decodificador, buffer, PIXELES_PARTE)) > 0) {
+        pixeles += escritos;
+    }
+    *comprimidos = decodificador.data - datos;
+    return pixeles;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    double comienzo, transcurrido, velocidad;
+    uint32_t pixeles, comprimidos;
+    uint64_t bytes;
+
+    printf("Bus SPI: %.2f MB/s\n", SPI_BYTES_POR_SEGUNDO / 1e6);
+    printf("%-10s %8s %10s %8s %14s %12s\n", "imagen", "pixeles", "comprimida", "razón", "decodifica MB/s",
+           "veces el bus");
+    for (uint8_t imagen = 0; imagen < sizeof(IMAGENES) / sizeof(IMAGENES[0]); imagen++) {
+        pixeles = Decodificar(IMAGENES[imagen].datos, &comprimidos);
+        VERIFICAR(pixeles > 0, "%s: imagen vacía", IMAGENES[imagen].nombre);
+
+        bytes = 0;
+        comienzo = Segundos();
+        do {
+            bytes += 2 * Decodificar(IMAGENES[imagen].datos, &comprimidos);
+            transcurrido = Segundos() - comienzo;
+        } while (transcurrido < DURACION);
+        velocidad = bytes / transcurrido;
+
+        printf("%-10s %8u %10u %7.1fx %14.1f %11.1fx\n", IMAGENES[imagen].nombre, pixeles, comprimidos,
+               2.0 * pixeles / comprimidos, velocidad / 1e6, velocidad / SPI_BYTES_POR_SEGUNDO);
+    }
+    return Terminar("benchmark_rle565");
+}
+
+/* === End of documentation ======================================================================================== */
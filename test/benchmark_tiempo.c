@@ -0,0 +1,155 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file benchmark_tiempo.c
+ ** @brief Medición del formato de tiempos comparado con snprintf
+ **
+ ** Cada formato se mide con TiempoTexto y con el snprintf equivalente que usaba displayTask, sobre una secuencia de
+ ** tiempos que recorre todos los campos. TiempoDigitos se mide contra separar los digitos con divisiones.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "prueba.h"
+#include "tiempo.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Tiempo que se mide cada versión, en segundos
+#define DURACION 0.2
+
+//! @brief Milisegundos entre dos llamadas, primo para recorrer todos los valores de cada campo
+#define PASO 7919
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Versión a medir, escribe el tiempo en un destino y devuelve un valor que depende del resultado
+typedef uint32_t (*version_t)(uint32_t milisegundos);
+
+//! @brief Par de versiones de una misma operación
+typedef struct medicion_s {
+    const char * nombre; //!< Nombre de la operación
+    version_t snprintf;  //!< Versión con snprintf o divisiones
+    version_t tiempo;    //!< Versión del módulo tiempo
+} medicion_t;
+
+/* === Private variable definitions ================================================================================ */
+
+static char texto[TIEMPO_TEXTO_MAXIMO + 1];
+
+static uint8_t digitos[TIEMPO_DIGITOS_MAXIMO];
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t SnprintfMinutos(uint32_t ms) {
+    return snprintf(texto, sizeof(texto), "%02u:%02u.%02u", ms / 60000 % 100, ms / 1000 % 60, ms % 1000 / 10);
+}
+
+static uint32_t TiempoMinutos(uint32_t ms) {
+    return TiempoTexto(texto, ms, TIEMPO_MM_SS_CC);
+}
+
+static uint32_t SnprintfHoras(uint32_t ms) {
+    return snprintf(texto, sizeof(texto), "%02u:%02u:%02u", ms / 3600000 % 100, ms / 60000 % 60, ms / 1000 % 60);
+}
+
+static uint32_t TiempoHoras(uint32_t ms) {
+    return TiempoTexto(texto, ms, TIEMPO_HH_MM_SS);
+}
+
+static uint32_t SnprintfSegundos(uint32_t ms) {
+    return snprintf(texto, sizeof(texto), "%02u.%03u", ms / 1000 % 60, ms % 1000);
+}
+
+static uint32_t TiempoSegundos(uint32_t ms) {
+    return TiempoTexto(texto, ms, TIEMPO_SS_MMM);
+}
+
+static uint32_t DivisionesDigitos(uint32_t ms) {
+    uint32_t minutos = ms / 60000 % 100, segundos = ms / 1000 % 60, centesimas = ms % 1000 / 10;
+
+    digitos[0] = minutos / 10;
+    digitos[1] = minutos % 10;
+    digitos[2] = segundos / 10;
+    digitos[3] = segundos % 10;
+    digitos[4] = centesimas / 10;
+    digitos[5] = centesimas % 10;
+    return TIEMPO_DIGITOS_MAXIMO;
+}
+
+static uint32_t TiempoDigitosMinutos(uint32_t ms) {
+    return TiempoDigitos(digitos, ms, TIEMPO_MM_SS_CC);
+}
+
+static double Medir(version_t version, uint8_t * salida) {
+    double comienzo = Segundos(), transcurrido;
+    uint64_t llamadas = 0;
+    uint32_t ms = 0, suma = 0;
+
+    do {
+        for (int vuelta = 0; vuelta < 1024; vuelta++) {
+            suma += version(ms);
+            suma += salida[0] + salida[TIEMPO_DIGITOS_MAXIMO - 1];
+            ms += PASO;
+        }
+        llamadas += 1024;
+        transcurrido = Segundos() - comienzo;
+    } while (transcurrido < DURACION);
+    /* La suma evita que el compilador descarte las llamadas */
+    VERIFICAR(suma != 0, "resultado vacío");
+    return transcurrido * 1e9 / llamadas;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const medicion_t MEDICIONES[] = {
+        {"TiempoTexto mm:ss.cc", SnprintfMinutos, TiempoMinutos},
+        {"TiempoTexto hh:mm:ss", SnprintfHoras, TiempoHoras},
+        {"TiempoTexto ss.mmm", SnprintfSegundos, TiempoSegundos},
+        {"TiempoDigitos mm:ss.cc", DivisionesDigitos, TiempoDigitosMinutos},
+    };
+    char esperado[TIEMPO_TEXTO_MAXIMO + 1];
+    uint8_t esperados[TIEMPO_DIGITOS_MAXIMO];
+    double referencia, tiempo;
+
+    printf("%-24s %14s %12s %8s\n", "operación", "snprintf ns", "tiempo ns", "mejora");
+    for (uint8_t indice = 0; indice < sizeof(MEDICIONES) / sizeof(MEDICIONES[0]); indice++) {
+        const medicion_t * medicion = &MEDICIONES[indice];
+
+        for (uint32_t ms = 0; ms < 100 * PASO; ms += PASO) {
+            medicion->snprintf(ms);
+            memcpy(esperado, texto, sizeof(texto));
+            memcpy(esperados, digitos, sizeof(digitos));
+            medicion->tiempo(ms);
+            VERIFICAR((memcmp(esperado, texto, sizeof(texto)) == 0) &&
+                          (memcmp(esperados, digitos, sizeof(digitos)) == 0),
+                      "%s: %u ms, las versiones no coinciden", medicion->nombre, ms);
+        }
+
+        referencia = Medir(medicion->snprintf, (indice < 3) ? (uint8_t *)texto : digitos);
+        tiempo = Medir(medicion->tiempo, (indice < 3) ? (uint8_t *)texto : digitos);
+        printf("%-24s %14.1f %12.1f %7.1fx\n", medicion->nombre, referencia, tiempo, referencia / tiempo);
+    }
+    return Terminar("benchmark_tiempo");
+}
+
+/* === End of documentation ======================================================================================== */
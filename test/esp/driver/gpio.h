@@ -0,0 +1,21 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <stdint.h>
+
+#define GPIO_MODE_OUTPUT 2
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    int mode;
+    int pull_up_en;
+    int pull_down_en;
+    int intr_type;
+} gpio_config_t;
+
+int gpio_config(const gpio_config_t * config);
+
+int gpio_set_level(int gpio, uint32_t level);
+
+#endif /* GPIO_H_ */
@@ -0,0 +1,71 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef SPI_MASTER_H_
+#define SPI_MASTER_H_
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define SPI2_HOST                1
+#define SPI_DMA_CH_AUTO          3
+#define SPI_TRANS_USE_TXDATA     (1 << 3)
+#define SPI_TRANS_CS_KEEP_ACTIVE (1 << 8)
+
+typedef struct spi_transaction_t spi_transaction_t;
+
+typedef void (*transaction_cb_t)(spi_transaction_t * trans);
+
+struct spi_transaction_t {
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+    size_t length;
+    size_t rxlength;
+    void * user;
+    union {
+        const void * tx_buffer;
+        uint8_t tx_data[4];
+    };
+    union {
+        void * rx_buffer;
+        uint8_t rx_data[4];
+    };
+};
+
+typedef struct {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+} spi_bus_config_t;
+
+typedef struct {
+    int clock_speed_hz;
+    int mode;
+    int spics_io_num;
+    int queue_size;
+    transaction_cb_t pre_cb;
+    transaction_cb_t post_cb;
+    uint32_t flags;
+} spi_device_interface_config_t;
+
+typedef struct spi_device_t * spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t * config, int dma);
+
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t * config, spi_device_handle_t * handle);
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t * trans);
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t * trans, TickType_t wait);
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t ** trans, TickType_t wait);
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t wait);
+
+void spi_device_release_bus(spi_device_handle_t handle);
+
+#endif /* SPI_MASTER_H_ */
@@ -0,0 +1,12 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef ESP_ERR_H_
+#define ESP_ERR_H_
+
+#include <assert.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK                0
+#define ESP_ERROR_CHECK(error) assert((error) == ESP_OK)
+
+#endif /* ESP_ERR_H_ */
@@ -0,0 +1,14 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef ESP_HEAP_CAPS_H_
+#define ESP_HEAP_CAPS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+
+void * heap_caps_malloc(size_t size, uint32_t caps);
+
+void heap_caps_free(void * ptr);
+
+#endif /* ESP_HEAP_CAPS_H_ */
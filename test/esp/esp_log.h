@@ -0,0 +1,10 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef ESP_LOG_H_
+#define ESP_LOG_H_
+
+#include <stdio.h>
+
+//! Los mensajes de error van a la salida de errores con la etiqueta adelante
+#define ESP_LOGE(tag, formato, ...) fprintf(stderr, "E (%s) " formato "\n", tag, ##__VA_ARGS__)
+
+#endif /* ESP_LOG_H_ */
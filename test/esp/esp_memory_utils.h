@@ -0,0 +1,10 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef ESP_MEMORY_UTILS_H_
+#define ESP_MEMORY_UTILS_H_
+
+#include <stdbool.h>
+
+//! En las pruebas solo las constantes del programa quedan fuera de la memoria accesible por DMA, como la flash
+bool esp_ptr_dma_capable(const void * ptr);
+
+#endif /* ESP_MEMORY_UTILS_H_ */
@@ -0,0 +1,10 @@
+/* Versión mínima de la cabecera de ESP-IDF para compilar el controlador en las pruebas de la computadora */
+#ifndef ESP_TIMER_H_
+#define ESP_TIMER_H_
+
+#include <stdint.h>
+
+//! Microsegundos del reloj monótono de la computadora
+int64_t esp_timer_get_time(void);
+
+#endif /* ESP_TIMER_H_ */
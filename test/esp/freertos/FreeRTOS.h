@@ -0,0 +1,14 @@
+/* Versión mínima de la cabecera de FreeRTOS para compilar el controlador en las pruebas de la computadora */
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+
+#endif /* FREERTOS_H_ */
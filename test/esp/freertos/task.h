@@ -0,0 +1,10 @@
+/* Versión mínima de la cabecera de FreeRTOS para compilar el controlador en las pruebas de la computadora */
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+//! Las demoras no esperan, el bus simulado termina cada transacción en el momento
+void vTaskDelay(TickType_t ticks);
+
+#endif /* TASK_H_ */
@@ -0,0 +1,56 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef IMAGENES_H_
+#define IMAGENES_H_
+
+/** @file imagenes.h
+ ** @brief Imágenes de prueba generadas con test/imagenes.py y comprimidas con tools/rle565.py al compilar las pruebas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Public data type declarations =============================================================================== */
+
+//! @brief Imagen de prueba comprimida
+typedef struct imagen_s {
+    const char * nombre;   //!< Nombre de la imagen, también el del archivo con los pixeles originales
+    const uint8_t * datos; //!< Imagen comprimida, empezando por la cabecera
+} imagen_t;
+
+/* === Public variable declarations ================================================================================ */
+
+extern const uint8_t imagen_interfaz[];
+extern const uint8_t imagen_degradado[];
+extern const uint8_t imagen_ruido[];
+extern const uint8_t imagen_plano[];
+
+//! @brief Todas las imágenes de prueba
+static const imagen_t IMAGENES[] = {
+    {"interfaz", imagen_interfaz},
+    {"degradado", imagen_degradado},
+    {"ruido", imagen_ruido},
+    {"plano", imagen_plano},
+};
+
+/* === End of documentation ======================================================================================== */
+
+#endif /* IMAGENES_H_ */
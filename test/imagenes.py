@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+"""Generador de las imagenes de prueba del compresor RGB565.
+
+Escribe imagenes RGB565 crudas, con el byte alto primero, que cubren los casos del formato de main/rle565.h: zonas de
+un solo color, degradados que se codifican como diferencias, pocos colores que se repiten desde la tabla y ruido que
+solo se puede guardar sin comprimir. Usa una semilla fija para que las imagenes sean siempre las mismas.
+
+Uso:
+    test/imagenes.py build-test/imagenes
+"""
+
+import argparse
+import os
+import random
+
+
+def rgb565(red, green, blue):
+    return ((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3)
+
+
+def interfaz(width, height, generator):
+    """Pantalla con fondo liso, paneles de pocos colores y texto simulado con bloques pequeños."""
+    colors = [rgb565(0, 0, 0), rgb565(255, 0, 0), rgb565(24, 0, 0), rgb565(255, 255, 255), rgb565(0, 96, 160)]
+    pixels = [colors[0]] * (width * height)
+    for _ in range(40):
+        x, y = generator.randrange(width), generator.randrange(height)
+        w, h = generator.randrange(4, 80), generator.randrange(2, 40)
+        color = generator.choice(colors)
+        for row in range(y, min(y + h, height)):
+            for column in range(x, min(x + w, width)):
+                pixels[row * width + column] = color
+    return pixels
+
+
+def degradado(width, height, generator):
+    """Degradados suaves en las dos direcciones, con un poco de ruido en el bit menos significativo."""
+    pixels = []
+    for row in range(height):
+        for column in range(width):
+            red = (column * 255) // (width - 1)
+            green = (row * 255) // (height - 1)
+            blue = ((column + row) * 255) // (width + height - 2)
+            pixels.append(rgb565(red, green, blue) ^ generator.randrange(2))
+    return pixels
+
+
+def ruido(width, height, generator):
+    """Pixeles al azar, el peor caso del compresor."""
+    return [generator.randrange(0x10000) for _ in range(width * height)]
+
+
+def plano(width, height, generator):
+    """Un solo color en toda la pantalla, necesita varias repeticiones largas seguidas."""
+    return [rgb565(0, 128, 255)] * (width * height)
+
+
+IMAGES = (
+    ("interfaz", 320, 240, interfaz),
+    ("degradado", 320, 240, degradado),
+    ("ruido", 64, 64, ruido),
+    ("plano", 480, 320, plano),
+)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("directory", help="carpeta donde se escriben las imagenes")
+    args = parser.parse_args()
+
+    os.makedirs(args.directory, exist_ok=True)
+    for name, width, height, generate in IMAGES:
+        pixels = generate(width, height, random.Random(name))
+        with open(os.path.join(args.directory, name + ".bin"), "wb") as output:
+            output.write(b"".join(bytes((color >> 8, color & 0xFF)) for color in pixels))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,80 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PRUEBA_H_
+#define PRUEBA_H_
+
+/** @file prueba.h
+ ** @brief Utilidades comunes de las pruebas y mediciones que se compilan y ejecutan en la computadora de desarrollo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Public macros definitions =================================================================================== */
+
+//! @brief Bytes por segundo del bus SPI de la pantalla, con la frecuencia SPI_BR de ili9341.c
+#define SPI_BYTES_POR_SEGUNDO (51000000.0 / 8)
+
+//! @brief Verifica una condición y cuenta un error si no se cumple, mostrando solo los primeros para no inundar la salida
+#define VERIFICAR(condicion, ...)                                                                                      \
+    do {                                                                                                               \
+        if (!(condicion) && (prueba_errores++ < 10)) {                                                                 \
+            printf("%s:%d: ", __FILE__, __LINE__);                                                                     \
+            printf(__VA_ARGS__);                                                                                       \
+            printf("\n");                                                                                              \
+        }                                                                                                              \
+    } while (0)
+
+/* === Public variable declarations ================================================================================ */
+
+//! @brief Cantidad de verificaciones que fallaron en la prueba
+static int prueba_errores;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para leer un reloj monotónico con resolución de nanosegundos
+ *
+ * @return double Segundos desde un instante arbitrario
+ */
+static inline double Segundos(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return ahora.tv_sec + ahora.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Función para terminar una prueba informando el resultado
+ *
+ * @param  nombre Nombre de la prueba
+ * @return int    Código de salida del programa, cero si todas las verificaciones se cumplieron
+ */
+static inline int Terminar(const char * nombre) {
+    printf("%s: %s, %d errores\n", nombre, prueba_errores ? "FALLA" : "ok", prueba_errores);
+    return prueba_errores ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* === End of documentation ======================================================================================== */
+
+#endif /* PRUEBA_H_ */
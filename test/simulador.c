@@ -0,0 +1,305 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file simulador.c
+ ** @brief Simulación del bus SPI y de la memoria de la pantalla para probar el controlador en la computadora
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "simulador.h"
+#include "driver/gpio.h"
+#include "driver/spi_master.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "ili9341.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Comando de rango de columnas
+#define CASET 0x2A
+
+//! @brief Comando de rango de filas
+#define PASET 0x2B
+
+//! @brief Comando de escritura de memoria
+#define RAMWR 0x2C
+
+//! @brief Transacciones que se pueden encolar, el queue_size que configura el controlador
+#define MAXIMO_ENCOLADAS 7
+
+//! @brief Termina el programa informando una violación del protocolo del controlador
+#define FALLAR(...)                                                                                                    \
+    do {                                                                                                               \
+        fprintf(stderr, "simulador: " __VA_ARGS__);                                                                    \
+        fprintf(stderr, "\n");                                                                                         \
+        abort();                                                                                                       \
+    } while (0)
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Estado del controlador de la pantalla al interpretar los bytes recibidos
+typedef struct panel_s {
+    bool datos;             //!< Nivel de la línea D/C, los bytes son datos o comandos
+    uint8_t comando;        //!< Último comando recibido
+    uint8_t argumentos[4];  //!< Argumentos recibidos de un comando de rango
+    uint8_t recibidos;      //!< Cantidad de argumentos recibidos
+    uint16_t columnas[2];   //!< Rango de columnas de la ventana
+    uint16_t filas[2];      //!< Rango de filas de la ventana
+    uint16_t x;             //!< Columna del próximo pixel
+    uint16_t y;             //!< Fila del próximo pixel
+    bool mitad;             //!< Se recibió el primer byte del próximo pixel
+    uint8_t alto;           //!< Primer byte del próximo pixel
+} panel_t;
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función que interpreta un byte recibido por el controlador de la pantalla
+ *
+ * @param byte Byte recibido
+ */
+static void Recibir(uint8_t byte);
+
+/**
+ * @brief Función que ejecuta una transacción en el bus
+ *
+ * @param transaccion Transacción a ejecutar
+ */
+static void Ejecutar(spi_transaction_t * transaccion);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+static uint16_t memoria[SIMULADOR_FILAS][SIMULADOR_COLUMNAS];
+
+static simulador_contadores_t contadores;
+
+static panel_t panel;
+
+static transaction_cb_t antes;
+
+static spi_transaction_t * encoladas[MAXIMO_ENCOLADAS];
+
+static uint8_t primera, pendientes;
+
+static bool adquirido;
+
+/* === Private function definitions ================================================================================ */
+
+static void Recibir(uint8_t byte) {
+    if (!panel.datos) {
+        contadores.comandos++;
+        panel.comando = byte;
+        panel.recibidos = 0;
+        if (byte == CASET) {
+            contadores.columnas++;
+        } else if (byte == PASET) {
+            contadores.filas++;
+        } else if (byte == RAMWR) {
+            contadores.escrituras++;
+            panel.x = panel.columnas[0];
+            panel.y = panel.filas[0];
+            panel.mitad = false;
+        }
+        return;
+    }
+
+    if ((panel.comando == CASET) || (panel.comando == PASET)) {
+        if (panel.recibidos < sizeof(panel.argumentos)) {
+            panel.argumentos[panel.recibidos++] = byte;
+        }
+        if (panel.recibidos == sizeof(panel.argumentos)) {
+            uint16_t * rango = (panel.comando == CASET) ? panel.columnas : panel.filas;
+            rango[0] = (panel.argumentos[0] << 8) | panel.argumentos[1];
+            rango[1] = (panel.argumentos[2] << 8) | panel.argumentos[3];
+        }
+    } else if (panel.comando == RAMWR) {
+        if (!panel.mitad) {
+            panel.alto = byte;
+            panel.mitad = true;
+            return;
+        }
+        panel.mitad = false;
+        if ((panel.y <= panel.filas[1]) && (panel.x < SIMULADOR_COLUMNAS) && (panel.y < SIMULADOR_FILAS)) {
+            memoria[panel.y][panel.x] = (panel.alto << 8) | byte;
+        }
+        if (++panel.x > panel.columnas[1]) {
+            panel.x = panel.columnas[0];
+            panel.y++;
+        }
+    }
+}
+
+static void Ejecutar(spi_transaction_t * transaccion) {
+    const uint8_t * datos;
+    size_t bytes = transaccion->length / 8;
+
+    if (antes) {
+        antes(transaccion);
+    }
+    datos = (transaccion->flags & SPI_TRANS_USE_TXDATA) ? transaccion->tx_data : transaccion->tx_buffer;
+    contadores.transacciones++;
+    contadores.bytes += bytes;
+    for (size_t indice = 0; indice < bytes; indice++) {
+        Recibir(datos[indice]);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void SimuladorReiniciarContadores(void) {
+    contadores = (simulador_contadores_t){0};
+}
+
+void SimuladorLeerContadores(simulador_contadores_t * resultado) {
+    *resultado = contadores;
+}
+
+const uint16_t * SimuladorMemoria(void) {
+    return &memoria[0][0];
+}
+
+uint16_t SimuladorPixel(uint16_t x, uint16_t y) {
+    return memoria[y][x];
+}
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t * config, int dma) {
+    (void)host;
+    (void)config;
+    (void)dma;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t * config, spi_device_handle_t * handle) {
+    (void)host;
+    antes = config->pre_cb;
+    *handle = (spi_device_handle_t)&panel;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t * transaccion) {
+    (void)handle;
+    if (pendientes > 0) {
+        FALLAR("transacción por encuesta con %u transacciones DMA pendientes", pendientes);
+    }
+    Ejecutar(transaccion);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t * transaccion, TickType_t espera) {
+    (void)handle;
+    (void)espera;
+    if (pendientes == MAXIMO_ENCOLADAS) {
+        FALLAR("cola de transacciones DMA llena");
+    }
+    if (!(transaccion->flags & SPI_TRANS_USE_TXDATA)) {
+        if ((uintptr_t)transaccion->tx_buffer & 3) {
+            FALLAR("buffer DMA no alineado a palabra");
+        }
+        if (!esp_ptr_dma_capable(transaccion->tx_buffer)) {
+            FALLAR("buffer DMA fuera de la memoria interna");
+        }
+    }
+    contadores.encoladas++;
+    Ejecutar(transaccion);
+    encoladas[(primera + pendientes) % MAXIMO_ENCOLADAS] = transaccion;
+    pendientes++;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t ** transaccion,
+                                      TickType_t espera) {
+    (void)handle;
+    (void)espera;
+    if (pendientes == 0) {
+        FALLAR("resultado pedido sin transacciones DMA pendientes");
+    }
+    *transaccion = encoladas[primera];
+    primera = (primera + 1) % MAXIMO_ENCOLADAS;
+    pendientes--;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t espera) {
+    (void)handle;
+    (void)espera;
+    if (adquirido) {
+        FALLAR("el bus ya estaba adquirido");
+    }
+    adquirido = true;
+    return ESP_OK;
+}
+
+void spi_device_release_bus(spi_device_handle_t handle) {
+    (void)handle;
+    if (!adquirido) {
+        FALLAR("se libera el bus sin haberlo adquirido");
+    }
+    adquirido = false;
+}
+
+int gpio_config(const gpio_config_t * config) {
+    (void)config;
+    return ESP_OK;
+}
+
+int gpio_set_level(int gpio, uint32_t level) {
+    if (gpio == ILI9341_PIN_NUM_DC) {
+        panel.datos = level;
+    }
+    return ESP_OK;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    (void)ticks;
+}
+
+void * heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    return aligned_alloc(4, (size + 3) & ~(size_t)3);
+}
+
+void heap_caps_free(void * ptr) {
+    free(ptr);
+}
+
+bool esp_ptr_dma_capable(const void * ptr) {
+    /* Símbolos del enlazador de GNU que delimitan el código y las constantes del programa */
+    extern const char etext, __data_start;
+
+    return !(((const char *)ptr >= &etext) && ((const char *)ptr < &__data_start));
+}
+
+int64_t esp_timer_get_time(void) {
+    struct timespec ahora;
+
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (int64_t)ahora.tv_sec * 1000000 + ahora.tv_nsec / 1000;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,91 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SIMULADOR_H_
+#define SIMULADOR_H_
+
+/** @file simulador.h
+ ** @brief Simulación del bus SPI y de la memoria de la pantalla para probar el controlador en la computadora
+ **
+ ** Reemplaza las funciones de ESP-IDF que usa ili9341.c: cada transacción se ejecuta en el momento, se interpretan los
+ ** comandos de ventana y de escritura de memoria y se cuentan las transacciones, bytes y comandos enviados. Las
+ ** violaciones del protocolo del controlador, como una transacción por encuesta con transferencias DMA pendientes o
+ ** un buffer DMA fuera de la memoria interna, terminan el programa con un mensaje.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Public macros definitions =================================================================================== */
+
+//! @brief Columnas de la memoria de la pantalla simulada
+#define SIMULADOR_COLUMNAS 480
+
+//! @brief Filas de la memoria de la pantalla simulada
+#define SIMULADOR_FILAS 480
+
+/* === Public data type declarations =============================================================================== */
+
+//! @brief Contadores del tráfico en el bus simulado
+typedef struct simulador_contadores_s {
+    uint32_t transacciones; //!< Transacciones SPI, por encuesta y por DMA
+    uint32_t encoladas;     //!< Transacciones encoladas para DMA
+    uint32_t bytes;         //!< Bytes enviados, incluyendo comandos
+    uint32_t comandos;      //!< Bytes enviados con la línea D/C en comando
+    uint32_t columnas;      //!< Comandos de rango de columnas (CASET)
+    uint32_t filas;         //!< Comandos de rango de filas (PASET)
+    uint32_t escrituras;    //!< Comandos de escritura de memoria (RAMWR)
+} simulador_contadores_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para poner en cero los contadores del bus
+ */
+void SimuladorReiniciarContadores(void);
+
+/**
+ * @brief Función para leer los contadores del bus desde la última vez que se reiniciaron
+ *
+ * @param contadores Estructura donde se copian los contadores
+ */
+void SimuladorLeerContadores(simulador_contadores_t * contadores);
+
+/**
+ * @brief Función para leer la memoria de la pantalla simulada
+ *
+ * @return const uint16_t* Pixeles en RGB565, SIMULADOR_COLUMNAS por cada fila
+ */
+const uint16_t * SimuladorMemoria(void);
+
+/**
+ * @brief Función para leer un pixel de la memoria de la pantalla simulada
+ *
+ * @param  x        Columna del pixel
+ * @param  y        Fila del pixel
+ * @return uint16_t Color del pixel en RGB565
+ */
+uint16_t SimuladorPixel(uint16_t x, uint16_t y);
+
+/* === End of documentation ======================================================================================== */
+
+#endif /* SIMULADOR_H_ */
@@ -0,0 +1,162 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_agrupar.c
+ ** @brief Medición de las transacciones por cuadro del cronómetro con los cambios de los paneles agrupados
+ **
+ ** Se ejecutan 3000 cuadros de 40 ms del cronómetro sobre el bus simulado, dibujando los cambios de cada digito en
+ ** una sesión del bus como se hacía antes y agrupándolos con AgruparCambios y ConfirmarCambios como en main.c. Se
+ ** mide con los paneles de la aplicación, minutos y segundos animados y centésimas pre-dibujadas, y con paneles que
+ ** solo dibujan segmentos. Las dos formas tienen que dejar la misma pantalla y la agrupada no puede usar más
+ ** transacciones.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digitos.h"
+#include "ili9341.h"
+#include "prueba.h"
+#include "simulador.h"
+#include "tiempo.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Cuadros que se miden, dos minutos del cronómetro
+#define CUADROS 3000
+
+//! @brief Centésimas que avanza el cronómetro en cada cuadro de 40 ms
+#define AVANCES 4
+
+//! @brief Bytes de pixeles que pueden enviar las animaciones en cada cuadro, como ANIMACION_PRESUPUESTO de main.c
+#define PRESUPUESTO 12000
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Tráfico de una ejecución de los cuadros del cronómetro
+typedef struct medicion_s {
+    simulador_contadores_t bus; //!< Contadores del bus simulado
+    uint32_t omitidas;          //!< Rangos de columnas o filas que el controlador no envió porque no cambiaron
+} medicion_t;
+
+/* === Private variable definitions ================================================================================ */
+
+static const panel_geometria_t GEOMETRIA = GEOMETRIA_DIGITO(60, 36);
+
+//! Pantalla que deja la ejecución sin agrupar, para compararla con la agrupada
+static uint16_t pantalla[SIMULADOR_COLUMNAS * SIMULADOR_FILAS];
+
+/* === Private function definitions ================================================================================ */
+
+static medicion_t Ejecutar(bool agrupar, bool efectos) {
+    static uint8_t sprites[1024];
+    ili9341_bus_stats_t antes, despues;
+    tiempo_contador_t contador;
+    uint8_t digitos[TIEMPO_DIGITOS_MAXIMO];
+    uint8_t cambios;
+    panel_t paneles[3];
+    medicion_t medicion;
+
+    for (uint8_t indice = 0; indice < 3; indice++) {
+        paneles[indice] = CrearPanelGeometria(2 + 106 * indice, 60, 2, &GEOMETRIA, ILI9341_RED, 0x1800, 0);
+    }
+    PanelSeparador(paneles[0], 1, SEPARADOR_DOS_PUNTOS);
+    PanelSeparador(paneles[1], 1, SEPARADOR_DOS_PUNTOS);
+    if (efectos) {
+        PanelPredibujarDigitos(paneles[2], sprites, sizeof(sprites));
+        PanelAnimacion(paneles[0], ANIMACION_RODAR, 6);
+        PanelAnimacion(paneles[1], ANIMACION_RODAR, 6);
+    }
+    TiempoContadorIniciar(&contador, 0);
+
+    ILI9341GetBusStats(&antes);
+    SimuladorReiniciarContadores();
+    for (uint32_t cuadro = 0; cuadro < CUADROS; cuadro++) {
+        for (uint8_t avance = 0; avance < AVANCES; avance++) {
+            TiempoContadorAvanzar(&contador);
+        }
+        cambios = TiempoContadorLeer(&contador, digitos);
+
+        /* Antes cada digito que cambiaba se dibujaba en el orden de los paneles, en una sola sesión del bus */
+        if (agrupar) {
+            AgruparCambios();
+        } else if (cambios) {
+            ILI9341BeginBatch();
+        }
+        for (uint8_t posicion = 0; posicion < TIEMPO_DIGITOS_MAXIMO; posicion++) {
+            if (cambios & (1 << posicion)) {
+                DibujarDigito(paneles[posicion / 2], posicion % 2, digitos[posicion]);
+            }
+        }
+        if (!agrupar && cambios) {
+            ILI9341EndBatch();
+        }
+        PanelEncenderSeparador(paneles[0], 1, (digitos[3] & 1) == 0);
+        PanelEncenderSeparador(paneles[1], 1, (digitos[3] & 1) == 0);
+        if (agrupar) {
+            ConfirmarCambios();
+        }
+        AnimarPaneles(PRESUPUESTO);
+    }
+    while (AnimarPaneles(PRESUPUESTO)) {
+    }
+    SimuladorLeerContadores(&medicion.bus);
+    ILI9341GetBusStats(&despues);
+    medicion.omitidas = despues.windows_skipped - antes.windows_skipped;
+
+    for (uint8_t indice = 0; indice < 3; indice++) {
+        DestruirPanel(paneles[indice]);
+    }
+    return medicion;
+}
+
+static void Medir(const char * nombre, bool efectos) {
+    medicion_t directo, agrupado;
+
+    directo = Ejecutar(false, efectos);
+    memcpy(pantalla, SimuladorMemoria(), sizeof(pantalla));
+    agrupado = Ejecutar(true, efectos);
+    VERIFICAR(memcmp(pantalla, SimuladorMemoria(), sizeof(pantalla)) == 0,
+              "%s: la pantalla agrupada no coincide con la dibujada digito por digito", nombre);
+    VERIFICAR(agrupado.bus.transacciones <= directo.bus.transacciones,
+              "%s: agrupados %u transacciones, digito por digito %u", nombre, agrupado.bus.transacciones,
+              directo.bus.transacciones);
+
+    /* Cada rango omitido es un comando y sus cuatro bytes, dos transacciones que se enviaban antes de recordarlos */
+    printf("%s: transacciones por cuadro %.2f sin recordar la ventana, %.2f digito por digito, %.2f agrupadas\n",
+           nombre, (double)(directo.bus.transacciones + 2 * directo.omitidas) / CUADROS,
+           (double)directo.bus.transacciones / CUADROS, (double)agrupado.bus.transacciones / CUADROS);
+    printf("%s: comandos de ventana por cuadro %.2f digito por digito, %.2f agrupados\n", nombre,
+           (double)(directo.bus.columnas + directo.bus.filas) / CUADROS,
+           (double)(agrupado.bus.columnas + agrupado.bus.filas) / CUADROS);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    ILI9341Init();
+    ILI9341Rotate(ILI9341_Landscape_1);
+    Medir("paneles de main.c", true);
+    Medir("solo segmentos", false);
+    return Terminar("test_agrupar");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,344 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_digitos.c
+ ** @brief Prueba de las actualizaciones parciales de los paneles de digitos sobre el bus simulado
+ **
+ ** Cada cambio de valor de un digito tiene que dejar en la pantalla los mismos pixeles que dibujar el valor nuevo en
+ ** un panel recién creado, enviando solo los segmentos que cambian, y repetir el valor no tiene que enviar nada. Además
+ ** se cuenta el tráfico de un minuto del cronómetro con los contadores de los paneles, del controlador y del bus. Los
+ ** digitos pre-dibujados y los segmentos con forma tienen que coincidir con los dibujados por segmentos, también
+ ** cuando la memoria que se les entrega no alcanza.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digitos.h"
+#include "ili9341.h"
+#include "prueba.h"
+#include "simulador.h"
+#include "tiempo.h"
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Valor que apaga todos los segmentos de un digito
+#define APAGADO 16
+
+//! @brief Milisegundos entre dos cuadros del cronómetro, el período de displayTask
+#define PERIODO 40
+
+/* === Private variable definitions ================================================================================ */
+
+static const panel_geometria_t GEOMETRIA = GEOMETRIA_DIGITO(60, 36);
+
+//! Geometría de los paneles de main.c
+static const panel_geometria_t GEOMETRIA_GRANDE = GEOMETRIA_DIGITO(100, 60);
+
+//! Geometría de un panel alfanumérico, con segmentos diagonales
+static const panel_geometria_t GEOMETRIA_LETRAS = GEOMETRIA_ALFANUMERICA(60, 40);
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Transacciones(void) {
+    simulador_contadores_t contadores;
+
+    SimuladorLeerContadores(&contadores);
+    return contadores.transacciones;
+}
+
+static bool MismosPixeles(uint16_t x, uint16_t y, uint16_t otro_x, uint16_t otro_y, uint16_t ancho, uint16_t alto) {
+    for (uint16_t fila = 0; fila < alto; fila++) {
+        for (uint16_t columna = 0; columna < ancho; columna++) {
+            if (SimuladorPixel(x + columna, y + fila) != SimuladorPixel(otro_x + columna, otro_y + fila)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void ProbarCambios(void) {
+    panel_estadisticas_t antes, despues;
+    panel_t panel, referencia;
+
+    panel = CrearPanelGeometria(10, 10, 1, &GEOMETRIA, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    for (uint8_t anterior = 0; anterior <= APAGADO; anterior++) {
+        for (uint8_t valor = 0; valor <= APAGADO; valor++) {
+            DibujarDigito(panel, 0, anterior);
+            PanelEstadisticas(panel, &antes);
+            SimuladorReiniciarContadores();
+            DibujarDigito(panel, 0, valor);
+            PanelEstadisticas(panel, &despues);
+
+            if (valor == anterior) {
+                VERIFICAR(Transacciones() == 0, "%u -> %u: envía %u transacciones sin cambios", anterior, valor,
+                          Transacciones());
+                VERIFICAR(despues.omitidas == antes.omitidas + 1, "%u -> %u: no cuenta la omisión", anterior, valor);
+                continue;
+            }
+            VERIFICAR(despues.actualizaciones == antes.actualizaciones + 1, "%u -> %u: no cuenta la actualización",
+                      anterior, valor);
+            VERIFICAR(despues.segmentos - antes.segmentos <= GEOMETRIA.cantidad,
+                      "%u -> %u: redibuja %u segmentos", anterior, valor, despues.segmentos - antes.segmentos);
+
+            /* El digito tiene que quedar igual que uno dibujado desde cero */
+            referencia = CrearPanelGeometria(10, 120, 1, &GEOMETRIA, ILI9341_RED, 0x1800, ILI9341_BLACK);
+            DibujarDigito(referencia, 0, valor);
+            VERIFICAR(MismosPixeles(10, 10, 10, 120, GEOMETRIA.ancho, GEOMETRIA.alto),
+                      "%u -> %u: los pixeles no coinciden con el digito dibujado desde cero", anterior, valor);
+            DestruirPanel(referencia);
+        }
+    }
+    DestruirPanel(panel);
+}
+
+static void ProbarGeometriaCalculada(void) {
+    panel_t paneles[MAXIMO_PANELES];
+    panel_t referencia;
+
+    /* La geometría calculada al crear el panel dibuja lo mismo que la constante */
+    paneles[0] = CrearPanel(10, 10, 1, GEOMETRIA.alto, GEOMETRIA.ancho, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    VERIFICAR(paneles[0] != NULL, "no se pudo crear un panel calculando la geometría");
+    referencia = CrearPanelGeometria(10, 120, 1, &GEOMETRIA, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    for (uint8_t valor = 0; valor <= APAGADO; valor++) {
+        DibujarDigito(paneles[0], 0, valor);
+        DibujarDigito(referencia, 0, valor);
+        VERIFICAR(MismosPixeles(10, 10, 10, 120, GEOMETRIA.ancho, GEOMETRIA.alto),
+                  "el %u con la geometría calculada no coincide con la constante", valor);
+    }
+    DestruirPanel(referencia);
+
+    /* Destruir un panel devuelve su geometría a la reserva */
+    for (int indice = 1; indice < MAXIMO_PANELES; indice++) {
+        paneles[indice] = CrearPanel(10, 10, 1, GEOMETRIA.alto, GEOMETRIA.ancho, ILI9341_RED, 0x1800, ILI9341_BLACK);
+        VERIFICAR(paneles[indice] != NULL, "no se pudo crear el panel calculado %d", indice);
+    }
+    DestruirPanel(paneles[0]);
+    paneles[0] = CrearPanel(10, 10, 1, GEOMETRIA.alto, GEOMETRIA.ancho, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    VERIFICAR(paneles[0] != NULL, "la geometría de un panel destruido no volvió a la reserva");
+    for (int indice = 0; indice < MAXIMO_PANELES; indice++) {
+        DestruirPanel(paneles[indice]);
+    }
+}
+
+static void ProbarReutilizar(void) {
+    static const panel_geometria_t ANCHA = GEOMETRIA_DIGITO(800, 500);
+    static int8_t tabla[2048];
+    static const char * const TEXTOS[] = {"AKMX", "VWZ7", "/<>*", "    "};
+    panel_t panel, referencia;
+
+    /* Un digito más ancho que la pantalla no ocupa un panel */
+    VERIFICAR(CrearPanelGeometria(0, 0, 1, &ANCHA, ILI9341_RED, 0x1800, ILI9341_BLACK) == NULL,
+              "se creó un panel de %u pixeles de ancho", ANCHA.ancho);
+
+    /* Un panel rectangular en el lugar de uno con forma no hereda sus ventanas, tampoco al fundir los colores */
+    panel = CrearPanelGeometria(10, 10, 4, &GEOMETRIA_LETRAS, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    PanelFormaSegmentos(panel, SEGMENTOS_BISELADOS | SEGMENTOS_INCLINADOS, tabla, sizeof(tabla));
+    DestruirPanel(panel);
+    panel = CrearPanelGeometria(10, 10, 4, &GEOMETRIA_LETRAS, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    referencia = CrearPanelGeometria(10, 120, 4, &GEOMETRIA_LETRAS, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    VERIFICAR(panel != referencia, "el panel de referencia ocupa el mismo lugar");
+    PanelAnimacion(panel, ANIMACION_FUNDIR, 4);
+    PanelAnimacion(referencia, ANIMACION_FUNDIR, 4);
+    for (uint8_t texto = 0; texto < sizeof(TEXTOS) / sizeof(TEXTOS[0]); texto++) {
+        PanelMostrarTexto(panel, TEXTOS[texto]);
+        PanelMostrarTexto(referencia, TEXTOS[texto]);
+        while (AnimarPaneles(UINT32_MAX)) {
+        }
+        VERIFICAR(MismosPixeles(10, 10, 10, 120, 4 * GEOMETRIA_LETRAS.ancho, GEOMETRIA_LETRAS.alto),
+                  "\"%s\" no coincide con el de un panel que nunca tuvo forma", TEXTOS[texto]);
+    }
+    DestruirPanel(referencia);
+    DestruirPanel(panel);
+}
+
+static void ProbarSprites(const panel_geometria_t * geometria) {
+    static uint8_t memoria[2048];
+    uint16_t necesarios = 0;
+    panel_t panel, referencia;
+
+    /* El buffer más chico que alcanza para las imágenes de todos los valores */
+    panel = CrearPanelGeometria(10, 10, 1, geometria, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    for (uint16_t bytes = 1; bytes <= sizeof(memoria); bytes++) {
+        if (PanelPredibujarDigitos(panel, memoria, bytes)) {
+            necesarios = bytes;
+            break;
+        }
+    }
+    VERIFICAR(necesarios > 0, "digitos de %ux%u: las imágenes no entran en %zu bytes", geometria->alto,
+              geometria->ancho, sizeof(memoria));
+    printf("digitos de %ux%u: las imágenes ocupan %u bytes\n", geometria->alto, geometria->ancho, necesarios);
+
+    /* Con las imágenes, y sin ellas por falta de memoria, cada valor se dibuja igual que con segmentos */
+    referencia = CrearPanelGeometria(10, 200, 1, geometria, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    for (uint8_t caso = 0; caso < 2; caso++) {
+        VERIFICAR(PanelPredibujarDigitos(panel, memoria, caso ? necesarios - 1 : necesarios) == !caso,
+                  "digitos de %ux%u: con %u bytes no se esperaba ese resultado", geometria->alto, geometria->ancho,
+                  caso ? necesarios - 1 : necesarios);
+        for (uint8_t valor = 0; valor <= APAGADO; valor++) {
+            DibujarDigito(panel, 0, valor);
+            DibujarDigito(referencia, 0, valor);
+            VERIFICAR(MismosPixeles(10, 10, 10, 200, geometria->ancho, geometria->alto),
+                      "digitos de %ux%u con %s: el %u no coincide con los segmentos", geometria->alto,
+                      geometria->ancho, caso ? "segmentos" : "imágenes", valor);
+        }
+    }
+    VERIFICAR(!PanelPredibujarDigitos(panel, NULL, sizeof(memoria)), "sin buffer las imágenes siguen habilitadas");
+    DestruirPanel(referencia);
+    DestruirPanel(panel);
+}
+
+static void ProbarFormas(const panel_geometria_t * geometria, uint8_t forma) {
+    static int8_t tabla[2048], tabla_referencia[2048];
+    static uint8_t memoria[16384];
+    uint16_t necesarios = 0;
+    panel_t panel, referencia;
+
+    /* La tabla más chica que alcanza para la forma */
+    panel = CrearPanelGeometria(10, 10, 1, geometria, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    for (uint16_t bytes = 0; bytes <= sizeof(tabla); bytes += 2) {
+        if (PanelFormaSegmentos(panel, forma, tabla, bytes)) {
+            necesarios = bytes;
+            break;
+        }
+    }
+    VERIFICAR(necesarios > 0, "digitos de %ux%u, forma %u: la tabla no entra en %zu bytes", geometria->alto,
+              geometria->ancho, forma, sizeof(tabla));
+    printf("digitos de %ux%u, forma %u: la tabla ocupa %u bytes\n", geometria->alto, geometria->ancho, forma, necesarios);
+
+    /* Cada cambio deja los mismos pixeles que el valor dibujado en un panel nuevo, con la tabla en dirección impar */
+    for (uint8_t anterior = 0; anterior <= APAGADO; anterior += 3) {
+        for (uint8_t valor = 0; valor <= APAGADO; valor++) {
+            DibujarDigito(panel, 0, anterior);
+            DibujarDigito(panel, 0, valor);
+            referencia = CrearPanelGeometria(10, 200, 1, geometria, ILI9341_RED, 0x1800, ILI9341_BLACK);
+            VERIFICAR(PanelFormaSegmentos(referencia, forma, tabla_referencia + 1, necesarios + 1),
+                      "forma %u: la tabla desalineada de %u bytes no alcanza", forma, necesarios + 1);
+            DibujarDigito(referencia, 0, valor);
+            VERIFICAR(MismosPixeles(10, 10, 10, 200, geometria->ancho, geometria->alto),
+                      "forma %u, %u -> %u: los pixeles no coinciden con el digito dibujado desde cero", forma, anterior,
+                      valor);
+            DestruirPanel(referencia);
+        }
+    }
+
+    /* Las imágenes pre-dibujadas toman la forma de los segmentos, con filas distintas ocupan mucho más */
+    referencia = CrearPanelGeometria(10, 200, 1, geometria, ILI9341_RED, 0x1800, ILI9341_BLACK);
+    PanelFormaSegmentos(referencia, forma, tabla_referencia, sizeof(tabla_referencia));
+    VERIFICAR(PanelPredibujarDigitos(panel, memoria, sizeof(memoria)), "forma %u: sin imágenes pre-dibujadas", forma);
+    for (uint8_t valor = 0; valor <= APAGADO; valor++) {
+        DibujarDigito(panel, 0, valor);
+        DibujarDigito(referencia, 0, valor);
+        VERIFICAR(MismosPixeles(10, 10, 10, 200, geometria->ancho, geometria->alto),
+                  "forma %u: la imagen del %u no coincide con los segmentos", forma, valor);
+    }
+    PanelPredibujarDigitos(panel, NULL, 0);
+
+    /* Si la tabla no entra el panel queda con segmentos rectangulares */
+    PanelFormaSegmentos(referencia, SEGMENTOS_RECTANGULARES, NULL, 0);
+    VERIFICAR(!PanelFormaSegmentos(panel, forma, tabla, necesarios - 2), "forma %u: entra en %u bytes", forma,
+              necesarios - 2);
+    for (uint8_t valor = 0; valor <= APAGADO; valor++) {
+        DibujarDigito(panel, 0, valor);
+        DibujarDigito(referencia, 0, valor);
+        VERIFICAR(MismosPixeles(10, 10, 10, 200, geometria->ancho, geometria->alto),
+                  "forma %u sin memoria: el %u no coincide con los segmentos rectangulares", forma, valor);
+    }
+    DestruirPanel(referencia);
+    DestruirPanel(panel);
+}
+
+static void ProbarMinuto(void) {
+    uint8_t digitos[6], mostrados[6] = {APAGADO, APAGADO, APAGADO, APAGADO, APAGADO, APAGADO};
+    uint32_t actualizaciones[3] = {0}, omitidas[3] = {0};
+    simulador_contadores_t contadores;
+    ili9341_bus_stats_t antes, despues;
+    panel_estadisticas_t estadisticas;
+    panel_t paneles[3];
+    uint32_t cuadros = 0;
+
+    /* Al crearse cada panel dibuja sus digitos apagados, que también cuentan como actualizaciones */
+    for (uint8_t indice = 0; indice < 3; indice++) {
+        paneles[indice] = CrearPanelGeometria(2 + 106 * indice, 60, 2, &GEOMETRIA, ILI9341_RED, 0x1800, 0);
+        actualizaciones[indice] = 2;
+    }
+
+    ILI9341GetBusStats(&antes);
+    SimuladorReiniciarContadores();
+    for (uint32_t ms = 0; ms < 60000; ms += PERIODO) {
+        TiempoDigitos(digitos, ms, TIEMPO_MM_SS_CC);
+        for (uint8_t posicion = 0; posicion < 6; posicion++) {
+            DibujarDigito(paneles[posicion / 2], posicion % 2, digitos[posicion]);
+            if (digitos[posicion] == mostrados[posicion]) {
+                omitidas[posicion / 2]++;
+            } else {
+                actualizaciones[posicion / 2]++;
+                mostrados[posicion] = digitos[posicion];
+            }
+        }
+        cuadros++;
+    }
+    SimuladorLeerContadores(&contadores);
+    ILI9341GetBusStats(&despues);
+
+    for (uint8_t indice = 0; indice < 3; indice++) {
+        PanelEstadisticas(paneles[indice], &estadisticas);
+        VERIFICAR(estadisticas.actualizaciones == actualizaciones[indice],
+                  "panel %u: %u actualizaciones, se esperaban %u", indice, estadisticas.actualizaciones,
+                  actualizaciones[indice]);
+        VERIFICAR(estadisticas.omitidas == omitidas[indice], "panel %u: %u omitidas, se esperaban %u", indice,
+                  estadisticas.omitidas, omitidas[indice]);
+        printf("panel %u: %5u actualizaciones %5u omitidas %6u segmentos\n", indice, estadisticas.actualizaciones,
+               estadisticas.omitidas, estadisticas.segmentos);
+        DestruirPanel(paneles[indice]);
+    }
+
+    /* Los contadores del controlador tienen que coincidir con lo que recibe el bus */
+    VERIFICAR(despues.transactions - antes.transactions == contadores.transacciones,
+              "el controlador cuenta %u transacciones, el bus %u", despues.transactions - antes.transactions,
+              contadores.transacciones);
+    VERIFICAR(despues.commands - antes.commands == contadores.comandos, "el controlador cuenta %u comandos, el bus %u",
+              despues.commands - antes.commands, contadores.comandos);
+    VERIFICAR(despues.bytes - antes.bytes == contadores.bytes, "el controlador cuenta %u bytes, el bus %u",
+              despues.bytes - antes.bytes, contadores.bytes);
+    printf("un minuto a %u ms: %.2f transacciones, %.1f comandos y %.0f bytes por cuadro\n", PERIODO,
+           (double)contadores.transacciones / cuadros, (double)contadores.comandos / cuadros,
+           (double)contadores.bytes / cuadros);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    ILI9341Init();
+    ILI9341Rotate(ILI9341_Landscape_1);
+    ProbarCambios();
+    ProbarGeometriaCalculada();
+    ProbarReutilizar();
+    ProbarSprites(&GEOMETRIA);
+    ProbarSprites(&GEOMETRIA_GRANDE);
+    ProbarFormas(&GEOMETRIA, SEGMENTOS_BISELADOS);
+    ProbarFormas(&GEOMETRIA, SEGMENTOS_INCLINADOS);
+    ProbarFormas(&GEOMETRIA, SEGMENTOS_BISELADOS | SEGMENTOS_INCLINADOS);
+    ProbarFormas(&GEOMETRIA_GRANDE, SEGMENTOS_BISELADOS | SEGMENTOS_INCLINADOS);
+    ProbarMinuto();
+    return Terminar("test_digitos");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,142 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_etiquetas.c
+ ** @brief Prueba de las actualizaciones parciales de las etiquetas de texto sobre el bus simulado
+ **
+ ** Una etiqueta recibe una secuencia de textos al azar y, después de cada uno, sus pixeles tienen que ser los mismos
+ ** que dibujar el texto completo en una zona limpia. Se usa una fuente de ancho fijo y una de ancho variable con
+ ** kerning, donde la posición de cada tramo redibujado depende del caracter anterior.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "etiquetas.h"
+#include "ili9341.h"
+#include "prueba.h"
+#include "simulador.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Primer caracter de la fuente de prueba
+#define PRIMERO ' '
+
+//! @brief Cantidad de caracteres de la fuente de prueba, del espacio a la Z
+#define CARACTERES ('Z' - ' ' + 1)
+
+//! @brief Alto de los glifos de la fuente de prueba
+#define ALTO_GLIFO 10
+
+//! @brief Ancho en pixeles de la zona que se compara, mayor que el texto más largo
+#define ANCHO_ZONA 300
+
+//! @brief Cantidad de textos que recibe cada etiqueta
+#define TEXTOS 3000
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t mapa[CARACTERES * ALTO_GLIFO];
+
+static FontGlyph_t glifos[CARACTERES];
+
+//! Pares ordenados por el caracter de la izquierda y después por el de la derecha
+static const FontKerning_t PARES[] = {
+    {'A', 'T', -2}, {'A', 'V', -3}, {'L', 'T', -2}, {'P', 'A', 2}, {'T', 'A', -2}, {'V', 'A', -3}, {'V', '.', -4},
+};
+
+static Font_t fuente_kerning = {
+    .FontWidth = 10,
+    .FontHeight = 14,
+    .bitmap = mapa,
+    .glyphs = glifos,
+    .first = PRIMERO,
+    .count = CARACTERES,
+    .kerning = PARES,
+    .kerning_count = sizeof(PARES) / sizeof(PARES[0]),
+    .bpp = 1,
+};
+
+/* === Private function definitions ================================================================================ */
+
+static void CrearFuente(void) {
+    for (uint8_t indice = 0; indice < CARACTERES; indice++) {
+        uint8_t caracter = PRIMERO + indice;
+        uint8_t ancho = 5 + caracter % 4;
+
+        /* Cada glifo tiene un dibujo distinto para que un corrimiento de un pixel cambie la pantalla */
+        glifos[indice] = (FontGlyph_t){indice * ALTO_GLIFO, ancho, ALTO_GLIFO, 1, 2, ancho + 2};
+        for (uint8_t fila = 0; fila < ALTO_GLIFO; fila++) {
+            mapa[indice * ALTO_GLIFO + fila] = ((caracter * 37 + fila * 11) | 0x80) & (0xFF << (8 - ancho));
+        }
+    }
+    glifos[0].width = 0;
+}
+
+static void TextoAleatorio(char * texto) {
+    static const char ALFABETO[] = "AVLTP. 01";
+    uint8_t largo = rand() % 12;
+
+    for (uint8_t indice = 0; indice < largo; indice++) {
+        texto[indice] = ALFABETO[rand() % (sizeof(ALFABETO) - 1)];
+    }
+    texto[largo] = '\0';
+}
+
+static void ProbarFuente(const char * nombre, Font_t * fuente) {
+    const uint16_t frente = ILI9341_YELLOW, fondo = ILI9341_NAVY;
+    const uint16_t y = 10, y_referencia = 100;
+    char texto[MAXIMO_CARACTERES + 1], anterior[MAXIMO_CARACTERES + 1] = "";
+    etiqueta_t etiqueta;
+    bool iguales;
+
+    ILI9341DrawFilledRectangle(0, y, ANCHO_ZONA - 1, y + fuente->FontHeight - 1, fondo);
+    etiqueta = CrearEtiqueta(0, y, fuente, frente, fondo);
+    for (uint16_t vuelta = 0; vuelta < TEXTOS; vuelta++) {
+        TextoAleatorio(texto);
+        EscribirEtiqueta(etiqueta, texto);
+
+        ILI9341DrawFilledRectangle(0, y_referencia, ANCHO_ZONA - 1, y_referencia + fuente->FontHeight - 1, fondo);
+        ILI9341DrawString(0, y_referencia, texto, fuente, frente, fondo);
+        iguales = true;
+        for (uint16_t fila = 0; fila < fuente->FontHeight; fila++) {
+            for (uint16_t x = 0; x < ANCHO_ZONA; x++) {
+                iguales = iguales && (SimuladorPixel(x, y + fila) == SimuladorPixel(x, y_referencia + fila));
+            }
+        }
+        VERIFICAR(iguales, "%s: \"%s\" -> \"%s\" no coincide con el texto dibujado completo", nombre, anterior, texto);
+        strcpy(anterior, texto);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    srand(36);
+    CrearFuente();
+    ILI9341Init();
+    ILI9341Rotate(ILI9341_Landscape_1);
+    ProbarFuente("font_11x18", &font_11x18);
+    ProbarFuente("kerning", &fuente_kerning);
+    return Terminar("test_etiquetas");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,190 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_figuras.c
+ ** @brief Prueba de los rectángulos con esquinas redondeadas sobre el bus simulado
+ **
+ ** Sin radio, o cuando el rectángulo es tan angosto o tan bajo que el radio queda en cero, el contorno y el relleno
+ ** tienen que ser los de un rectángulo común. Con radio 1 solo faltan las cuatro esquinas. Con radios mayores el
+ ** contorno queda dentro del relleno, ninguno sale del rectángulo y los lados rectos están completos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "ili9341.h"
+#include "prueba.h"
+#include "simulador.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Borde de la zona que se revisa alrededor de cada rectángulo
+#define MARGEN 4
+
+//! @brief Color de las figuras, el fondo es negro
+#define COLOR ILI9341_WHITE
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Rectángulo con el radio pedido para sus esquinas
+typedef struct rectangulo_s {
+    uint16_t x0; //!< Columna de la esquina superior izquierda
+    uint16_t y0; //!< Fila de la esquina superior izquierda
+    uint16_t x1; //!< Columna de la esquina inferior derecha
+    uint16_t y1; //!< Fila de la esquina inferior derecha
+    uint16_t r;  //!< Radio de las esquinas
+} rectangulo_t;
+
+/* === Private variable definitions ================================================================================ */
+
+//! Rectángulos cuyo radio queda en 0 o en 1, con el resultado conocido
+static const rectangulo_t SIN_RADIO[] = {
+    {10, 10, 60, 40, 0}, {10, 10, 60, 40, 1}, {10, 10, 11, 40, 3}, {10, 10, 10, 40, 3},
+    {10, 10, 60, 11, 3}, {10, 10, 60, 10, 3}, {10, 10, 10, 10, 5}, {60, 40, 10, 10, 1},
+};
+
+//! Rectángulos con radios mayores, algunos recortados por el tamaño
+static const rectangulo_t CON_RADIO[] = {
+    {10, 10, 60, 40, 2}, {10, 10, 60, 40, 3}, {10, 10, 60, 40, 10}, {10, 10, 60, 40, 15},
+    {10, 10, 60, 40, 100}, {10, 10, 13, 40, 3}, {10, 10, 90, 90, 40},
+};
+
+/* === Private function definitions ================================================================================ */
+
+static void Ordenar(rectangulo_t * rectangulo) {
+    uint16_t auxiliar;
+
+    if (rectangulo->x0 > rectangulo->x1) {
+        auxiliar = rectangulo->x0;
+        rectangulo->x0 = rectangulo->x1;
+        rectangulo->x1 = auxiliar;
+    }
+    if (rectangulo->y0 > rectangulo->y1) {
+        auxiliar = rectangulo->y0;
+        rectangulo->y0 = rectangulo->y1;
+        rectangulo->y1 = auxiliar;
+    }
+}
+
+static void Dibujar(const rectangulo_t * rectangulo, bool relleno) {
+    ILI9341DrawFilledRectangle(0, 0, 100 + MARGEN, 100 + MARGEN, ILI9341_BLACK);
+    if (relleno) {
+        ILI9341DrawFilledRoundRectangle(rectangulo->x0, rectangulo->y0, rectangulo->x1, rectangulo->y1, rectangulo->r,
+                                        COLOR);
+    } else {
+        ILI9341DrawRoundRectangle(rectangulo->x0, rectangulo->y0, rectangulo->x1, rectangulo->y1, rectangulo->r,
+                                  COLOR);
+    }
+}
+
+static bool Encendido(uint16_t x, uint16_t y) {
+    return SimuladorPixel(x, y) == COLOR;
+}
+
+static void ProbarSinRadio(rectangulo_t rectangulo) {
+    bool borde, esquina, esperado, redondeado;
+
+    Ordenar(&rectangulo);
+    /* El radio se recorta a la mitad del lado más corto, en un rectángulo de 0 o 1 pixel de ancho queda en cero */
+    redondeado = (rectangulo.r > 0) && (rectangulo.x1 - rectangulo.x0 >= 2) && (rectangulo.y1 - rectangulo.y0 >= 2);
+
+    for (uint8_t relleno = 0; relleno < 2; relleno++) {
+        Dibujar(&rectangulo, relleno);
+        for (uint16_t y = 0; y <= rectangulo.y1 + MARGEN; y++) {
+            for (uint16_t x = 0; x <= rectangulo.x1 + MARGEN; x++) {
+                borde = (x == rectangulo.x0) || (x == rectangulo.x1) || (y == rectangulo.y0) || (y == rectangulo.y1);
+                esquina =
+                    ((x == rectangulo.x0) || (x == rectangulo.x1)) && ((y == rectangulo.y0) || (y == rectangulo.y1));
+                esperado = (x >= rectangulo.x0) && (x <= rectangulo.x1) && (y >= rectangulo.y0) &&
+                           (y <= rectangulo.y1) && (relleno || borde) && !(redondeado && esquina);
+                VERIFICAR(Encendido(x, y) == esperado, "(%u,%u,%u,%u) radio %u %s: el pixel (%u,%u) %s", rectangulo.x0,
+                          rectangulo.y0, rectangulo.x1, rectangulo.y1, rectangulo.r, relleno ? "relleno" : "contorno",
+                          x, y, esperado ? "falta" : "sobra");
+            }
+        }
+    }
+}
+
+static void ProbarConRadio(rectangulo_t rectangulo) {
+    static bool relleno[100 + MARGEN + 1][100 + MARGEN + 1];
+    uint16_t radio;
+    bool adentro;
+
+    Ordenar(&rectangulo);
+    radio = rectangulo.r;
+    if (radio > (rectangulo.x1 - rectangulo.x0) / 2) {
+        radio = (rectangulo.x1 - rectangulo.x0) / 2;
+    }
+    if (radio > (rectangulo.y1 - rectangulo.y0) / 2) {
+        radio = (rectangulo.y1 - rectangulo.y0) / 2;
+    }
+
+    /* El relleno cubre la cruz entre las esquinas y nada fuera del rectángulo */
+    Dibujar(&rectangulo, true);
+    for (uint16_t y = 0; y <= 100 + MARGEN; y++) {
+        for (uint16_t x = 0; x <= 100 + MARGEN; x++) {
+            adentro = (x >= rectangulo.x0) && (x <= rectangulo.x1) && (y >= rectangulo.y0) && (y <= rectangulo.y1);
+            relleno[y][x] = Encendido(x, y);
+            VERIFICAR(adentro || !relleno[y][x], "(%u,%u,%u,%u) radio %u relleno: sobra el pixel (%u,%u)",
+                      rectangulo.x0, rectangulo.y0, rectangulo.x1, rectangulo.y1, rectangulo.r, x, y);
+            if (((x >= rectangulo.x0 + radio) && (x <= rectangulo.x1 - radio) && adentro) ||
+                ((y >= rectangulo.y0 + radio) && (y <= rectangulo.y1 - radio) && adentro)) {
+                VERIFICAR(relleno[y][x], "(%u,%u,%u,%u) radio %u relleno: falta el pixel (%u,%u)", rectangulo.x0,
+                          rectangulo.y0, rectangulo.x1, rectangulo.y1, rectangulo.r, x, y);
+            }
+        }
+    }
+
+    /* El contorno tiene los lados rectos completos y queda dentro del relleno */
+    Dibujar(&rectangulo, false);
+    for (uint16_t y = 0; y <= 100 + MARGEN; y++) {
+        for (uint16_t x = 0; x <= 100 + MARGEN; x++) {
+            VERIFICAR(!Encendido(x, y) || relleno[y][x],
+                      "(%u,%u,%u,%u) radio %u contorno: el pixel (%u,%u) sale del relleno", rectangulo.x0,
+                      rectangulo.y0, rectangulo.x1, rectangulo.y1, rectangulo.r, x, y);
+        }
+    }
+    for (uint16_t x = rectangulo.x0 + radio; x <= rectangulo.x1 - radio; x++) {
+        VERIFICAR(Encendido(x, rectangulo.y0) && Encendido(x, rectangulo.y1),
+                  "(%u,%u,%u,%u) radio %u contorno: falta el borde horizontal en la columna %u", rectangulo.x0,
+                  rectangulo.y0, rectangulo.x1, rectangulo.y1, rectangulo.r, x);
+    }
+    for (uint16_t y = rectangulo.y0 + radio; y <= rectangulo.y1 - radio; y++) {
+        VERIFICAR(Encendido(rectangulo.x0, y) && Encendido(rectangulo.x1, y),
+                  "(%u,%u,%u,%u) radio %u contorno: falta el borde vertical en la fila %u", rectangulo.x0,
+                  rectangulo.y0, rectangulo.x1, rectangulo.y1, rectangulo.r, y);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    ILI9341Init();
+    ILI9341Rotate(ILI9341_Landscape_1);
+    for (uint8_t indice = 0; indice < sizeof(SIN_RADIO) / sizeof(SIN_RADIO[0]); indice++) {
+        ProbarSinRadio(SIN_RADIO[indice]);
+    }
+    for (uint8_t indice = 0; indice < sizeof(CON_RADIO) / sizeof(CON_RADIO[0]); indice++) {
+        ProbarConRadio(CON_RADIO[indice]);
+    }
+    return Terminar("test_figuras");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,176 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_fontpack.c
+ ** @brief Prueba de las fuentes generadas con tools/fontpack.py contra las fuentes de ancho fijo de origen
+ **
+ ** Cada glifo generado se vuelve a ubicar en su celda y se compara con el glifo de origen: en las fuentes de 1 bpp
+ ** tiene que coincidir pixel a pixel, y en las suavizadas cada nivel tiene que ser la fracción pintada del cuadrado de
+ ** origen que cubre. Las filas de las fuentes suavizadas se expanden además con RGB565ExpandLevels y con su versión de
+ ** referencia, como las dibuja el controlador.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "fonts.h"
+#include "prueba.h"
+#include "rgb565.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Primer caracter de las fuentes de ancho fijo
+#define PRIMER_CARACTER ' '
+
+//! @brief Último caracter de las fuentes de ancho fijo
+#define ULTIMO_CARACTER '~'
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Fuente generada junto con la fuente de origen y el factor de reducción con que se generó
+typedef struct generada_s {
+    const Font_t * fuente; //!< Fuente generada por tools/fontpack.py
+    const Font_t * origen; //!< Fuente de ancho fijo a partir de la que se generó
+    uint8_t reduccion;     //!< Pixeles de origen por cada pixel generado, en cada eje
+    const char * nombre;   //!< Nombre de la fuente generada, para los mensajes
+} generada_t;
+
+/* === Public variable declarations ================================================================================ */
+
+extern Font_t font_6x9_aa;
+
+extern Font_t font_8x13_aa;
+
+/* === Private function definitions ================================================================================ */
+
+static const FontGlyph_t * BuscarGlifo(const Font_t * fuente, uint16_t caracter) {
+    if ((caracter >= fuente->first) && (caracter - fuente->first < fuente->count)) {
+        return &fuente->glyphs[caracter - fuente->first];
+    }
+    for (uint16_t rango = 0; rango < fuente->range_count; rango++) {
+        if ((caracter >= fuente->ranges[rango].first) &&
+            (caracter - fuente->ranges[rango].first < fuente->ranges[rango].count)) {
+            return &fuente->glyphs[fuente->ranges[rango].glyph + caracter - fuente->ranges[rango].first];
+        }
+    }
+    return NULL;
+}
+
+static uint8_t NivelGenerado(const Font_t * fuente, const FontGlyph_t * glifo, uint8_t x, uint8_t y) {
+    uint8_t bpp = fuente->bpp ? fuente->bpp : 1;
+    uint8_t maximo = (1 << bpp) - 1;
+    const uint8_t * fila;
+    uint16_t bit;
+
+    if ((x < glifo->x_offset) || (x - glifo->x_offset >= glifo->width) || (y < glifo->y_offset) ||
+        (y - glifo->y_offset >= glifo->height)) {
+        return 0;
+    }
+    fila = fuente->bitmap + glifo->offset + (y - glifo->y_offset) * ((glifo->width * bpp + 7) / 8);
+    bit = (x - glifo->x_offset) * bpp;
+    return (fila[bit / 8] >> (8 - bpp - bit % 8)) & maximo;
+}
+
+static uint8_t NivelEsperado(const generada_t * generada, uint16_t caracter, uint8_t x, uint8_t y) {
+    const Font_t * origen = generada->origen;
+    const uint16_t * filas = origen->data + (caracter - PRIMER_CARACTER) * origen->FontHeight;
+    uint8_t maximo = (1 << generada->fuente->bpp) - 1;
+    uint16_t area = generada->reduccion * generada->reduccion;
+    uint16_t pintados = 0;
+
+    for (uint8_t fila = y * generada->reduccion; fila < (y + 1) * generada->reduccion; fila++) {
+        for (uint8_t columna = x * generada->reduccion; columna < (x + 1) * generada->reduccion; columna++) {
+            if ((fila < origen->FontHeight) && (columna < origen->FontWidth) && (filas[fila] & (0x8000 >> columna))) {
+                pintados++;
+            }
+        }
+    }
+    return (2 * pintados * maximo + area) / (2 * area);
+}
+
+static void ExpandirFilas(const generada_t * generada, const FontGlyph_t * glifo, uint16_t caracter) {
+    static uint8_t esperado[2 * UINT8_MAX + 8] __attribute__((aligned(4)));
+    static uint8_t obtenido[2 * UINT8_MAX + 8] __attribute__((aligned(4)));
+    const Font_t * fuente = generada->fuente;
+    uint8_t stride = (glifo->width * fuente->bpp + 7) / 8;
+    rgb565_blend_lut_t lut;
+
+    RGB565BuildBlendLut(&lut, 0xFFE0, 0x0010, fuente->bpp);
+    for (uint8_t destino = 0; destino < 4; destino++) {
+        for (uint8_t fila = 0; fila < glifo->height; fila++) {
+            const uint8_t * niveles = fuente->bitmap + glifo->offset + fila * stride;
+
+            memset(esperado, 0x5A, sizeof(esperado));
+            memset(obtenido, 0x5A, sizeof(obtenido));
+            RGB565ExpandLevelsReference(&esperado[destino], niveles, fuente->bpp, glifo->width, 0xFFE0, 0x0010);
+            RGB565ExpandLevels(&obtenido[destino], niveles, glifo->width, &lut);
+            VERIFICAR(memcmp(esperado, obtenido, sizeof(esperado)) == 0, "%s: '%c' fila %u, alineación %u distinta",
+                      generada->nombre, caracter, fila, destino);
+        }
+    }
+}
+
+static void ProbarFuente(const generada_t * generada) {
+    const Font_t * fuente = generada->fuente;
+    const FontGlyph_t * glifo;
+    uint16_t caracteres = 0;
+
+    VERIFICAR(fuente->FontWidth == (generada->origen->FontWidth + generada->reduccion - 1) / generada->reduccion,
+              "%s: ancho de celda %u", generada->nombre, fuente->FontWidth);
+    VERIFICAR(fuente->FontHeight == (generada->origen->FontHeight + generada->reduccion - 1) / generada->reduccion,
+              "%s: alto de celda %u", generada->nombre, fuente->FontHeight);
+    for (uint16_t caracter = PRIMER_CARACTER; caracter <= ULTIMO_CARACTER; caracter++) {
+        glifo = BuscarGlifo(fuente, caracter);
+        if (glifo == NULL) {
+            continue;
+        }
+        caracteres++;
+        VERIFICAR(glifo->advance == fuente->FontWidth, "%s: '%c' avanza %u", generada->nombre, caracter,
+                  glifo->advance);
+        for (uint8_t y = 0; y < fuente->FontHeight; y++) {
+            for (uint8_t x = 0; x < fuente->FontWidth; x++) {
+                VERIFICAR(NivelGenerado(fuente, glifo, x, y) == NivelEsperado(generada, caracter, x, y),
+                          "%s: '%c' pixel %u,%u tiene el nivel %u, se esperaba %u", generada->nombre, caracter, x, y,
+                          NivelGenerado(fuente, glifo, x, y), NivelEsperado(generada, caracter, x, y));
+            }
+        }
+        if (fuente->bpp > 1) {
+            ExpandirFilas(generada, glifo, caracter);
+        }
+    }
+    VERIFICAR(caracteres > 0, "%s: no tiene caracteres", generada->nombre);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const generada_t GENERADAS[] = {
+        {&font_16x26_digits, &font_16x26, 1, "font_16x26_digits"},
+        {&font_6x9_aa, &font_11x18, 2, "font_6x9_aa"},
+        {&font_8x13_aa, &font_16x26, 2, "font_8x13_aa"},
+    };
+
+    for (uint8_t indice = 0; indice < sizeof(GENERADAS) / sizeof(GENERADAS[0]); indice++) {
+        ProbarFuente(&GENERADAS[indice]);
+    }
+    return Terminar("test_fontpack");
+}
+
+/* === End of documentation ======================================================================================== */
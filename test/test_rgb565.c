@@ -0,0 +1,231 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_rgb565.c
+ ** @brief Prueba de equivalencia de los núcleos de dos pixeles por palabra contra sus versiones de referencia
+ **
+ ** Cada núcleo se ejecuta con todas las alineaciones de origen y destino y con todas las longitudes hasta algo más de
+ ** una fila de la pantalla. Los dos destinos empiezan con los mismos bytes al azar y tienen que terminar iguales
+ ** byte a byte, así también se detecta si un núcleo escribe fuera de los pixeles pedidos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "prueba.h"
+#include "rgb565.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Cantidad máxima de pixeles de cada caso, una fila completa de la pantalla horizontal y algunos más
+#define PIXELES_MAXIMO 330
+
+//! @brief Bytes de cada buffer, con lugar para desalinear el comienzo y para detectar escrituras después del final
+#define BUFFER_BYTES (PIXELES_MAXIMO * 2 + 16)
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t origen[BUFFER_BYTES] __attribute__((aligned(4)));
+
+static uint8_t esperado[BUFFER_BYTES] __attribute__((aligned(4)));
+
+static uint8_t obtenido[BUFFER_BYTES] __attribute__((aligned(4)));
+
+/* === Private function definitions ================================================================================ */
+
+static void Aleatorio(uint8_t * buffer, uint32_t bytes) {
+    for (uint32_t indice = 0; indice < bytes; indice++) {
+        buffer[indice] = rand();
+    }
+}
+
+static void Preparar(void) {
+    Aleatorio(origen, sizeof(origen));
+    Aleatorio(esperado, sizeof(esperado));
+    memcpy(obtenido, esperado, sizeof(obtenido));
+}
+
+static void Comparar(const char * nucleo, uint8_t alineacion, uint32_t pixeles) {
+    VERIFICAR(memcmp(esperado, obtenido, sizeof(esperado)) == 0, "%s: alineación %u, %u pixeles, salida distinta",
+              nucleo, alineacion, pixeles);
+}
+
+static void ProbarFill(void) {
+    for (uint8_t destino = 0; destino < 4; destino++) {
+        for (uint32_t pixeles = 0; pixeles <= PIXELES_MAXIMO; pixeles++) {
+            uint16_t color = rand();
+            Preparar();
+            RGB565FillReference(&esperado[destino], color, pixeles);
+            RGB565Fill(&obtenido[destino], color, pixeles);
+            Comparar("RGB565Fill", destino, pixeles);
+        }
+    }
+}
+
+static void ProbarSwap(void) {
+    for (uint8_t destino = 0; destino < 4; destino++) {
+        for (uint8_t fuente = 0; fuente < 4; fuente++) {
+            for (uint32_t pixeles = 0; pixeles <= PIXELES_MAXIMO; pixeles++) {
+                Preparar();
+                RGB565SwapReference(&esperado[destino], &origen[fuente], pixeles);
+                RGB565Swap(&obtenido[destino], &origen[fuente], pixeles);
+                Comparar("RGB565Swap", destino * 4 + fuente, pixeles);
+            }
+        }
+        /* El intercambio también se usa sobre el mismo buffer */
+        for (uint32_t pixeles = 0; pixeles <= PIXELES_MAXIMO; pixeles++) {
+            Preparar();
+            RGB565SwapReference(&esperado[destino], &esperado[destino], pixeles);
+            RGB565Swap(&obtenido[destino], &obtenido[destino], pixeles);
+            Comparar("RGB565Swap en el lugar", destino, pixeles);
+        }
+    }
+}
+
+static void Mezclar(uint8_t * fondo, const uint8_t * frente, uint8_t alfa, uint32_t pixeles) {
+    uint16_t color;
+
+    /* RGB565Blend no tiene versión de referencia, se compara con la mezcla de cada pixel por separado */
+    for (; pixeles > 0; pixeles--) {
+        color = RGB565BlendColor((frente[0] << 8) | frente[1], (fondo[0] << 8) | fondo[1], alfa);
+        fondo[0] = color >> 8;
+        fondo[1] = color & 0xFF;
+        fondo += 2;
+        frente += 2;
+    }
+}
+
+static void ProbarBlend(void) {
+    static const uint8_t ALFAS[] = {0, 1, 4, 7, 8, 100, 128, 200, 251, 252, RGB565_ALPHA_MAX};
+
+    for (uint8_t alfa = 0; alfa < sizeof(ALFAS); alfa++) {
+        for (uint8_t destino = 0; destino < 4; destino++) {
+            for (uint8_t fuente = 0; fuente < 4; fuente++) {
+                for (uint32_t pixeles = 0; pixeles <= PIXELES_MAXIMO; pixeles++) {
+                    Preparar();
+                    Mezclar(&esperado[destino], &origen[fuente], ALFAS[alfa], pixeles);
+                    RGB565Blend(&obtenido[destino], &origen[fuente], ALFAS[alfa], pixeles);
+                    Comparar("RGB565Blend", destino * 4 + fuente, pixeles);
+                }
+            }
+        }
+    }
+}
+
+static void ProbarPaletteExpand(void) {
+    uint16_t paleta[RGB565_PALETTE_SIZE];
+
+    for (uint8_t destino = 0; destino < 4; destino++) {
+        for (uint8_t fuente = 0; fuente < 4; fuente++) {
+            for (uint32_t pixeles = 0; pixeles <= PIXELES_MAXIMO; pixeles++) {
+                Preparar();
+                Aleatorio((uint8_t *)paleta, sizeof(paleta));
+                RGB565PaletteExpandReference(&esperado[destino], &origen[fuente], paleta, pixeles);
+                RGB565PaletteExpand(&obtenido[destino], &origen[fuente], paleta, pixeles);
+                Comparar("RGB565PaletteExpand", destino * 4 + fuente, pixeles);
+            }
+        }
+    }
+}
+
+static void ProbarScale(void) {
+    uint8_t *final_esperado, *final_obtenido;
+
+    for (uint8_t escala = 1; escala <= 4; escala++) {
+        for (uint8_t destino = 0; destino < 4; destino++) {
+            for (uint8_t fuente = 0; fuente < 4; fuente++) {
+                for (uint32_t pixeles = 0; pixeles * escala <= PIXELES_MAXIMO; pixeles++) {
+                    Preparar();
+                    final_esperado = RGB565ScaleReference(&esperado[destino], &origen[fuente], pixeles, escala);
+                    final_obtenido = RGB565Scale(&obtenido[destino], &origen[fuente], pixeles, escala);
+                    Comparar("RGB565Scale", destino * 4 + fuente, pixeles);
+                    VERIFICAR(final_esperado - esperado == final_obtenido - obtenido,
+                              "RGB565Scale: escala %u, %u pixeles, devuelve otra posición", escala, pixeles);
+                }
+            }
+        }
+    }
+}
+
+static void ProbarExpandBits(void) {
+    rgb565_nibble_lut_t lut;
+    uint8_t *final_esperado, *final_obtenido;
+    uint16_t frente, fondo;
+    uint32_t bits;
+
+    for (uint8_t destino = 0; destino < 4; destino++) {
+        for (uint8_t ancho = 0; ancho <= 32; ancho++) {
+            for (uint8_t vuelta = 0; vuelta < 16; vuelta++) {
+                frente = rand();
+                fondo = rand();
+                bits = ((uint32_t)rand() << 16) ^ rand();
+                RGB565BuildNibbleLut(&lut, frente, fondo);
+                Preparar();
+                final_esperado = RGB565ExpandBitsReference(&esperado[destino], bits, ancho, frente, fondo);
+                final_obtenido = RGB565ExpandBits(&obtenido[destino], bits, ancho, &lut);
+                Comparar("RGB565ExpandBits", destino, ancho);
+                VERIFICAR(final_esperado - esperado == final_obtenido - obtenido,
+                          "RGB565ExpandBits: %u pixeles, devuelve otra posición", ancho);
+            }
+        }
+    }
+}
+
+static void ProbarExpandLevels(void) {
+    rgb565_blend_lut_t lut;
+    uint8_t *final_esperado, *final_obtenido;
+    uint16_t frente, fondo;
+
+    for (uint8_t bpp = 2; bpp <= 4; bpp += 2) {
+        for (uint8_t destino = 0; destino < 4; destino++) {
+            for (uint8_t fuente = 0; fuente < 4; fuente++) {
+                for (uint32_t pixeles = 0; pixeles <= UINT8_MAX; pixeles++) {
+                    frente = rand();
+                    fondo = rand();
+                    RGB565BuildBlendLut(&lut, frente, fondo, bpp);
+                    Preparar();
+                    final_esperado =
+                        RGB565ExpandLevelsReference(&esperado[destino], &origen[fuente], bpp, pixeles, frente, fondo);
+                    final_obtenido = RGB565ExpandLevels(&obtenido[destino], &origen[fuente], pixeles, &lut);
+                    Comparar(bpp == 2 ? "RGB565ExpandLevels 2 bpp" : "RGB565ExpandLevels 4 bpp", destino * 4 + fuente,
+                             pixeles);
+                    VERIFICAR(final_esperado - esperado == final_obtenido - obtenido,
+                              "RGB565ExpandLevels: %u bpp, %u pixeles, devuelve otra posición", bpp, pixeles);
+                }
+            }
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    srand(565);
+    ProbarFill();
+    ProbarSwap();
+    ProbarBlend();
+    ProbarPaletteExpand();
+    ProbarScale();
+    ProbarExpandBits();
+    ProbarExpandLevels();
+    return Terminar("test_rgb565");
+}
+
+/* === End of documentation ======================================================================================== */
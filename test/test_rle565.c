@@ -0,0 +1,111 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_rle565.c
+ ** @brief Prueba de ida y vuelta del formato RLE565: compresión con tools/rle565.py y decodificación con rle565.c
+ **
+ ** Cada imagen se decodifica en partes de distintos tamaños, desde un pixel hasta la imagen completa, y el resultado se
+ ** compara con los pixeles originales. Las partes chicas obligan a cortar repeticiones y grupos de literales entre dos
+ ** llamadas al decodificador.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "imagenes.h"
+#include "prueba.h"
+#include "rle565.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Pixeles máximos de una imagen de prueba, la pantalla completa
+#define PIXELES_MAXIMO (480 * 320)
+
+/* === Private variable definitions ================================================================================ */
+
+static uint8_t original[PIXELES_MAXIMO * 2];
+
+static uint8_t decodificada[PIXELES_MAXIMO * 2 + 2];
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t LeerOriginal(const char * carpeta, const char * nombre) {
+    char ruta[512];
+    FILE * archivo;
+    size_t leidos;
+
+    snprintf(ruta, sizeof(ruta), "%s/%s.bin", carpeta, nombre);
+    archivo = fopen(ruta, "rb");
+    if (!archivo) {
+        VERIFICAR(0, "no se puede abrir %s", ruta);
+        return 0;
+    }
+    leidos = fread(original, 1, sizeof(original), archivo);
+    fclose(archivo);
+    return leidos / 2;
+}
+
+static void ProbarImagen(const char * carpeta, const imagen_t * imagen) {
+    static const uint32_t PARTES[] = {1, 3, 7, 64, 65, 320, 5120, PIXELES_MAXIMO};
+    rle565_decoder_t decodificador;
+    uint32_t pixeles, escritos, total;
+
+    pixeles = LeerOriginal(carpeta, imagen->nombre);
+    for (uint8_t parte = 0; parte < sizeof(PARTES) / sizeof(PARTES[0]); parte++) {
+        VERIFICAR(RLE565DecoderInit(&decodificador, imagen->datos) == 0, "%s: cabecera inválida", imagen->nombre);
+        VERIFICAR((uint32_t)decodificador.width * decodificador.height == pixeles, "%s: %ux%u, el original tiene %u pixeles",
+                  imagen->nombre, decodificador.width, decodificador.height, pixeles);
+
+        /* El byte que sigue a la imagen no se puede escribir */
+        memset(decodificada, 0x5A, sizeof(decodificada));
+        total = 0;
+        do {
+            escritos = RLE565Decode(&decodificador, &decodificada[total * 2], PARTES[parte]);
+            VERIFICAR(escritos <= PARTES[parte], "%s: escribe %u pixeles de %u", imagen->nombre, escritos, PARTES[parte]);
+            total += escritos;
+        } while ((escritos > 0) && (total <= pixeles));
+
+        VERIFICAR(total == pixeles, "%s: partes de %u, decodifica %u pixeles de %u", imagen->nombre, PARTES[parte],
+                  total, pixeles);
+        VERIFICAR(memcmp(original, decodificada, pixeles * 2) == 0, "%s: partes de %u, pixeles distintos",
+                  imagen->nombre, PARTES[parte]);
+        VERIFICAR((decodificada[pixeles * 2] == 0x5A) && (decodificada[pixeles * 2 + 1] == 0x5A),
+                  "%s: partes de %u, escribe después del último pixel", imagen->nombre, PARTES[parte]);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    static const uint8_t INVALIDA[] = {'R', '6', 0, 1, 0, 1, 0};
+    rle565_decoder_t decodificador;
+
+    if (argc < 2) {
+        printf("uso: %s carpeta-de-imagenes\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    for (uint8_t imagen = 0; imagen < sizeof(IMAGENES) / sizeof(IMAGENES[0]); imagen++) {
+        ProbarImagen(argv[1], &IMAGENES[imagen]);
+    }
+    VERIFICAR(RLE565DecoderInit(&decodificador, INVALIDA) == -1, "acepta una firma inválida");
+    return Terminar("test_rle565");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,151 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_tiempo.c
+ ** @brief Prueba del formato de tiempos contra snprintf
+ **
+ ** Cada formato se compara con el texto que produce snprintf para todos los milisegundos de las primeras horas y para
+ ** un barrido de todo el rango de 32 bits. Los digitos de TiempoDigitos y los campos de TiempoSeparar tienen que
+ ** coincidir con el mismo texto. El contador de centésimas se avanza más de un millón de veces, pasando varias veces por
+ ** la vuelta a cero, y en cada lectura sus digitos y sus cambios tienen que coincidir con los de TiempoDigitos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "prueba.h"
+#include "tiempo.h"
+#include <stdint.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! @brief Milisegundos que se prueban uno por uno, algo más de una hora para pasar por el cambio de hora
+#define PRUEBA_COMPLETA 4000000
+
+//! @brief Paso del barrido del resto del rango, primo para no repetir siempre los mismos milisegundos
+#define PASO_BARRIDO 9973
+
+//! @brief Centésimas que cuenta el contador antes de volver a cero, de 00:00.00 a 99:59.99
+#define PERIODO_CONTADOR 600000
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t Referencia(char * texto, uint32_t milisegundos, tiempo_formato_t formato) {
+    uint32_t segundos = milisegundos / 1000, minutos = segundos / 60, horas = minutos / 60;
+
+    switch (formato) {
+    case TIEMPO_MM_SS_CC:
+        return snprintf(texto, TIEMPO_TEXTO_MAXIMO + 1, "%02u:%02u.%02u", minutos % 100, segundos % 60,
+                        milisegundos % 1000 / 10);
+    case TIEMPO_HH_MM_SS:
+        return snprintf(texto, TIEMPO_TEXTO_MAXIMO + 1, "%02u:%02u:%02u", horas % 100, minutos % 60, segundos % 60);
+    default:
+        return snprintf(texto, TIEMPO_TEXTO_MAXIMO + 1, "%02u.%03u", segundos % 60, milisegundos % 1000);
+    }
+}
+
+static void Probar(uint32_t milisegundos) {
+    static const tiempo_formato_t FORMATOS[] = {TIEMPO_MM_SS_CC, TIEMPO_HH_MM_SS, TIEMPO_SS_MMM};
+    char esperado[TIEMPO_TEXTO_MAXIMO + 1], obtenido[TIEMPO_TEXTO_MAXIMO + 1];
+    uint8_t digitos[TIEMPO_DIGITOS_MAXIMO], largo, cantidad, digito;
+    tiempo_t tiempo;
+
+    for (uint8_t indice = 0; indice < sizeof(FORMATOS) / sizeof(FORMATOS[0]); indice++) {
+        largo = Referencia(esperado, milisegundos, FORMATOS[indice]);
+        VERIFICAR(TiempoTexto(obtenido, milisegundos, FORMATOS[indice]) == largo, "%u ms, formato %u: largo distinto",
+                  milisegundos, FORMATOS[indice]);
+        VERIFICAR(strcmp(esperado, obtenido) == 0, "%u ms, formato %u: \"%s\", se esperaba \"%s\"", milisegundos,
+                  FORMATOS[indice], obtenido, esperado);
+
+        /* Los digitos son los del texto sin los separadores */
+        cantidad = TiempoDigitos(digitos, milisegundos, FORMATOS[indice]);
+        digito = 0;
+        for (uint8_t caracter = 0; caracter < largo; caracter++) {
+            if ((esperado[caracter] >= '0') && (esperado[caracter] <= '9')) {
+                VERIFICAR((digito < cantidad) && (digitos[digito] == esperado[caracter] - '0'),
+                          "%u ms, formato %u: el digito %u no coincide con \"%s\"", milisegundos, FORMATOS[indice],
+                          digito, esperado);
+                digito++;
+            }
+        }
+        VERIFICAR(digito == cantidad, "%u ms, formato %u: %u digitos, se esperaban %u", milisegundos,
+                  FORMATOS[indice], cantidad, digito);
+    }
+
+    TiempoSeparar(&tiempo, milisegundos);
+    VERIFICAR((tiempo.horas == milisegundos / 3600000) && (tiempo.minutos == milisegundos / 60000 % 60) &&
+                  (tiempo.segundos == milisegundos / 1000 % 60) && (tiempo.milisegundos == milisegundos % 1000),
+              "%u ms: se separa en %u:%u:%u.%u", milisegundos, tiempo.horas, tiempo.minutos, tiempo.segundos,
+              tiempo.milisegundos);
+}
+
+static void ProbarContador(uint32_t inicio, uint32_t avances, uint8_t lectura) {
+    uint8_t anteriores[TIEMPO_DIGITOS_MAXIMO], esperados[TIEMPO_DIGITOS_MAXIMO], digitos[TIEMPO_DIGITOS_MAXIMO];
+    uint8_t cambios, acumulados = 0;
+    uint32_t centesimas = inicio % PERIODO_CONTADOR;
+    tiempo_contador_t contador;
+
+    /* Al iniciar todos los digitos cuentan como cambiados */
+    TiempoContadorIniciar(&contador, centesimas);
+    TiempoDigitos(anteriores, centesimas * 10, TIEMPO_MM_SS_CC);
+    cambios = TiempoContadorLeer(&contador, digitos);
+    VERIFICAR(cambios == (1 << TIEMPO_DIGITOS_MAXIMO) - 1, "inicio en %u: cambios 0x%02x", centesimas, cambios);
+    VERIFICAR(memcmp(digitos, anteriores, sizeof(digitos)) == 0, "inicio en %u: digitos distintos", centesimas);
+
+    /* Los cambios de cada lectura son los digitos que cambiaron en alguno de los avances desde la anterior */
+    for (uint32_t avance = 1; avance <= avances; avance++) {
+        TiempoContadorAvanzar(&contador);
+        centesimas = (centesimas + 1) % PERIODO_CONTADOR;
+        TiempoDigitos(esperados, centesimas * 10, TIEMPO_MM_SS_CC);
+        for (uint8_t indice = 0; indice < TIEMPO_DIGITOS_MAXIMO; indice++) {
+            if (esperados[indice] != anteriores[indice]) {
+                acumulados |= 1 << indice;
+            }
+        }
+        memcpy(anteriores, esperados, sizeof(anteriores));
+
+        if (avance % lectura == 0) {
+            cambios = TiempoContadorLeer(&contador, digitos);
+            VERIFICAR(memcmp(digitos, esperados, sizeof(digitos)) == 0, "%u centésimas: digitos distintos", centesimas);
+            VERIFICAR(cambios == acumulados, "%u centésimas: cambios 0x%02x, se esperaba 0x%02x", centesimas, cambios,
+                      acumulados);
+            acumulados = 0;
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    for (uint32_t milisegundos = 0; milisegundos < PRUEBA_COMPLETA; milisegundos++) {
+        Probar(milisegundos);
+    }
+    for (uint64_t milisegundos = PRUEBA_COMPLETA; milisegundos <= UINT32_MAX; milisegundos += PASO_BARRIDO) {
+        Probar(milisegundos);
+    }
+    Probar(UINT32_MAX);
+
+    /* Leyendo en cada centésima, cada cuatro como los cuadros de 40 ms y cada siete para no alinearse con los digitos */
+    ProbarContador(0, 2 * PERIODO_CONTADOR + 12345, 1);
+    ProbarContador(PERIODO_CONTADOR - 10, PERIODO_CONTADOR, 4);
+    ProbarContador(123457, PERIODO_CONTADOR + 1000, 7);
+    return Terminar("test_tiempo");
+}
+
+/* === End of documentation ======================================================================================== */
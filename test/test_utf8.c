@@ -0,0 +1,99 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_utf8.c
+ ** @brief Prueba de la decodificación UTF-8 del texto del controlador sobre el bus simulado
+ **
+ ** Con una fuente de ancho fijo el ancho de un texto es la cantidad de caracteres decodificados por el avance, así que
+ ** ILI9341GetStringSize muestra cuántos U+FFFD produce cada secuencia inválida. Los caracteres que la fuente no tiene
+ ** se dibujan como espacios, así que el texto dibujado también tiene que coincidir con el mismo texto con espacios.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "ili9341.h"
+#include "prueba.h"
+#include "simulador.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Private data type declarations ============================================================================== */
+
+//! @brief Texto con la cantidad de caracteres que tiene que decodificar y su versión con espacios
+typedef struct caso_s {
+    const char * texto;       //!< Texto en UTF-8, posiblemente inválido
+    uint8_t caracteres;       //!< Cantidad de caracteres que se decodifican
+    const char * equivalente; //!< Texto que se dibuja igual, con espacios en lugar de los caracteres que no se dibujan
+} caso_t;
+
+/* === Private variable definitions ================================================================================ */
+
+static const caso_t CASOS[] = {
+    {"abc", 3, "abc"},
+    {"a\xE2\x82\xAC" "b", 3, "a b"},            /* U+20AC, tres bytes */
+    {"\xF0\x9F\x98\x80", 1, " "},               /* U+1F600, fuera del plano básico */
+    {"a\xF0\x9F\x98\x80" "b", 3, "a b"},
+    {"\xF4\x8F\xBF\xBF", 1, " "},               /* U+10FFFF, el último código */
+    {"\xF4\x90\x80\x80", 4, "    "},            /* Mayor que U+10FFFF */
+    {"\xF0\x8F\xBF\xBF", 4, "    "},            /* U+FFFF codificado con cuatro bytes */
+    {"\xF5\x80\x80\x80", 4, "    "},            /* Byte inicial inválido */
+    {"\xF0\x9F\x98", 3, "   "},                 /* Secuencia cortada por el final del texto */
+    {"\xF0\x9F\x98" "x", 4, "   x"},            /* Secuencia cortada por otro caracter */
+    {"\xED\x9F\xBF", 1, " "},                   /* U+D7FF, antes de los sustitutos */
+    {"\xED\xA0\x80", 3, "   "},                 /* U+D800, primer sustituto */
+    {"\xED\xBF\xBF", 3, "   "},                 /* U+DFFF, último sustituto */
+    {"\xEE\x80\x80", 1, " "},                   /* U+E000, después de los sustitutos */
+    {"\xC0\xAF", 2, "  "},                      /* Barra codificada con dos bytes */
+    {"\xE0\x80\xAF", 3, "   "},                 /* Barra codificada con tres bytes */
+    {"\x80" "a", 2, " a"},                      /* Continuación sin byte inicial */
+};
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    const uint16_t y = 10, y_equivalente = 40;
+    uint16_t ancho, alto, ancho_equivalente;
+    bool iguales;
+
+    ILI9341Init();
+    ILI9341Rotate(ILI9341_Landscape_1);
+    for (uint8_t indice = 0; indice < sizeof(CASOS) / sizeof(CASOS[0]); indice++) {
+        const caso_t * caso = &CASOS[indice];
+
+        ILI9341GetStringSize((char *)caso->texto, &font_7x10, &ancho, &alto);
+        VERIFICAR(ancho == caso->caracteres * font_7x10.FontWidth, "caso %u: %u caracteres, se esperaban %u", indice,
+                  ancho / font_7x10.FontWidth, caso->caracteres);
+
+        ILI9341GetStringSize((char *)caso->equivalente, &font_7x10, &ancho_equivalente, &alto);
+        ILI9341DrawFilledRectangle(0, y, 99, y + alto - 1, ILI9341_NAVY);
+        ILI9341DrawFilledRectangle(0, y_equivalente, 99, y_equivalente + alto - 1, ILI9341_NAVY);
+        ILI9341DrawString(0, y, (char *)caso->texto, &font_7x10, ILI9341_WHITE, ILI9341_BLACK);
+        ILI9341DrawString(0, y_equivalente, (char *)caso->equivalente, &font_7x10, ILI9341_WHITE, ILI9341_BLACK);
+        iguales = true;
+        for (uint16_t fila = 0; fila < alto; fila++) {
+            for (uint16_t x = 0; x < 100; x++) {
+                iguales = iguales && (SimuladorPixel(x, y + fila) == SimuladorPixel(x, y_equivalente + fila));
+            }
+        }
+        VERIFICAR(iguales, "caso %u: se dibuja distinto que \"%s\"", indice, caso->equivalente);
+    }
+    return Terminar("test_utf8");
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+"""Generador de subconjuntos empaquetados de las fuentes de main/fonts.c.
+
+Lee las tablas de ancho fijo de main/fonts.c, que guardan cada fila de un glifo en una palabra de 16 bits, y genera
+fuentes en el formato generalizado de main/fonts.h con solo los caracteres indicados. Cada glifo se recorta a su
+rectángulo ocupado y sus filas se empaquetan de a bit, manteniendo el avance original para que el texto no cambie de
+lugar. El rango contiguo más largo de caracteres se indexa en forma directa y el resto con rangos ordenados.
+
+Con --bpp 2 o 4 se generan fuentes suavizadas: cada pixel de la fuente generada cubre un cuadrado de --reduce pixeles
+de lado de la fuente de origen, y su nivel es la fracción de ese cuadrado que está pintada. La celda y el avance se
+dividen por el mismo factor, así que una fuente de 16x26 reducida a la mitad se dibuja como una de 8x13.
+
+Uso:
+    tools/fontpack.py main/fonts.c -o fonts_subset.c --font font_16x26 font_16x26_digits " -.0123456789:"
+    tools/fontpack.py main/fonts.c -o fonts_aa.c --bpp 4 --reduce 2 --font font_16x26 font_8x13_aa "0123456789"
+"""
+
+import argparse
+import re
+import sys
+
+FIRST_CHAR = 0x20
+CHAR_COUNT = 95
+GLYPH_SIZE = 12  # sizeof(FontGlyph_t): uint32_t y cinco uint8_t, alineado a 4 bytes
+RANGE_SIZE = 6  # sizeof(FontRange_t)
+
+
+def load_fonts(text):
+    tables = {}
+    for match in re.finditer(r"const\s+uint16_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};", text, re.S):
+        body = re.sub(r"/\*.*?\*/", "", match.group(2), flags=re.S)
+        tables[match.group(1)] = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    fonts = {}
+    for match in re.finditer(r"Font_t\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\w+)", text):
+        name, width, height, table = match.group(1), int(match.group(2)), int(match.group(3)), match.group(4)
+        fonts[name] = (width, height, tables[table])
+    return fonts
+
+
+def glyph_levels(rows, width, bpp, reduce):
+    """Calcula el nivel de cada pixel de la celda reducida a partir de las filas de 16 bits del glifo de origen."""
+    maximum = (1 << bpp) - 1
+    area = reduce * reduce
+    levels = []
+    for top in range(0, len(rows), reduce):
+        line = []
+        for left in range(0, width, reduce):
+            covered = 0
+            for row in rows[top : top + reduce]:
+                for column in range(left, min(left + reduce, width)):
+                    covered += (row >> (15 - column)) & 1
+            line.append((2 * covered * maximum + area) // (2 * area))
+        levels.append(line)
+    return levels
+
+
+def pack_glyph(levels, bpp):
+    """Recorta un glifo a su rectángulo ocupado y empaqueta sus filas, la primera columna en los bits más altos."""
+    used = [row for row in range(len(levels)) if any(levels[row])]
+    if not used:
+        return (0, 0, 0, 0), b""
+    columns = [column for column in range(len(levels[0])) if any(levels[row][column] for row in used)]
+    left, right = columns[0], columns[-1]
+    top, bottom = used[0], used[-1]
+    box_width = right - left + 1
+    stride = (box_width * bpp + 7) // 8
+    data = bytearray()
+    for row in range(top, bottom + 1):
+        bits = 0
+        for level in levels[row][left : right + 1]:
+            bits = (bits << bpp) | level
+        data.extend((bits << (stride * 8 - box_width * bpp)).to_bytes(stride, "big"))
+    return (box_width, bottom - top + 1, left, top), bytes(data)
+
+
+def split_ranges(codes):
+    ranges = []
+    for code in codes:
+        if ranges and ranges[-1][0] + ranges[-1][1] == code:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([code, 1])
+    return ranges
+
+
+def subset(source, name, width, height, table, charset, bpp=1, reduce=1):
+    codes = sorted(set(ord(char) for char in charset))
+    for code in codes:
+        if not FIRST_CHAR <= code < FIRST_CHAR + CHAR_COUNT:
+            raise ValueError("%s no tiene el caracter %r" % (source, chr(code)))
+
+    # El rango contiguo más largo ocupa los primeros glifos y se busca en forma directa
+    ranges = split_ranges(codes)
+    direct = max(ranges, key=lambda item: item[1])
+    others = [item for item in ranges if item is not direct]
+    order = list(range(direct[0], direct[0] + direct[1]))
+    extra = []
+    for first, count in others:
+        extra.append((first, count, len(order)))
+        order.extend(range(first, first + count))
+
+    cell_width = (width + reduce - 1) // reduce
+    cell_height = (height + reduce - 1) // reduce
+    bitmap = bytearray()
+    glyphs = []
+    for code in order:
+        index = (code - FIRST_CHAR) * height
+        levels = glyph_levels(table[index : index + height], width, bpp, reduce)
+        (box_width, box_height, x_offset, y_offset), data = pack_glyph(levels, bpp)
+        glyphs.append((len(bitmap), box_width, box_height, x_offset, y_offset, cell_width, chr(code)))
+        bitmap.extend(data)
+
+    lines = [
+        "static const uint8_t %s_bitmap[%d] = {" % (name, max(len(bitmap), 1)),
+    ]
+    for start in range(0, len(bitmap), 16):
+        lines.append("    " + ", ".join("0x%02X" % value for value in bitmap[start : start + 16]) + ",")
+    if not bitmap:
+        lines.append("    0x00,")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const FontGlyph_t %s_glyphs[%d] = {" % (name, len(glyphs)))
+    for offset, box_width, box_height, x_offset, y_offset, advance, char in glyphs:
+        comment = char if char != " " else "espacio"
+        fields = (offset, box_width, box_height, x_offset, y_offset, advance, comment)
+        lines.append("    {%d, %d, %d, %d, %d, %d}, /* %s */" % fields)
+    lines.append("};")
+    lines.append("")
+    if extra:
+        lines.append("static const FontRange_t %s_ranges[%d] = {" % (name, len(extra)))
+        for first, count, glyph in extra:
+            lines.append("    {0x%04X, %d, %d}," % (first, count, glyph))
+        lines.append("};")
+        lines.append("")
+    lines.extend(
+        [
+            "Font_t %s = {" % name,
+            "    .FontWidth = %d," % cell_width,
+            "    .FontHeight = %d," % cell_height,
+            "    .bitmap = %s_bitmap," % name,
+            "    .glyphs = %s_glyphs," % name,
+            "    .first = 0x%04X," % direct[0],
+            "    .count = %d," % direct[1],
+            "    .bpp = %d," % bpp,
+        ]
+    )
+    if extra:
+        lines.append("    .ranges = %s_ranges," % name)
+        lines.append("    .range_count = %d," % len(extra))
+    lines.append("};")
+
+    original = CHAR_COUNT * height * 2
+    packed = len(bitmap) + len(glyphs) * GLYPH_SIZE + len(extra) * RANGE_SIZE
+    report = "%s -> %s: %d caracteres de %dx%d a %d bpp, %d bytes -> %d bytes (%d bytes menos, %.0f%%)" % (
+        source,
+        name,
+        len(codes),
+        cell_width,
+        cell_height,
+        bpp,
+        original,
+        packed,
+        original - packed,
+        100.0 * (original - packed) / original,
+    )
+    return "\n".join(lines) + "\n", report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("fonts", help="archivo fonts.c con las fuentes de ancho fijo")
+    parser.add_argument("-o", "--output", required=True, help="archivo C a generar")
+    parser.add_argument(
+        "--font",
+        nargs=3,
+        action="append",
+        required=True,
+        metavar=("ORIGEN", "NOMBRE", "CARACTERES"),
+        help="fuente de origen, nombre de la fuente generada y caracteres que debe contener",
+    )
+    parser.add_argument(
+        "--bpp", type=int, choices=(1, 2, 4), default=1, help="bits por pixel de las fuentes generadas (1)"
+    )
+    parser.add_argument(
+        "--reduce",
+        type=int,
+        help="pixeles de origen por cada pixel generado, en cada eje (1 para 1 bpp, 2 para fuentes suavizadas)",
+    )
+    args = parser.parse_args()
+    if args.reduce is None:
+        args.reduce = 1 if args.bpp == 1 else 2
+    if args.reduce < 1:
+        parser.error("--reduce tiene que ser al menos 1")
+
+    with open(args.fonts, encoding="utf-8") as source:
+        fonts = load_fonts(source.read())
+
+    parts = [
+        "/* Generado con tools/fontpack.py a partir de %s, no editar */" % args.fonts,
+        "",
+        '#include "fonts.h"',
+        "",
+    ]
+    reports = []
+    for source, name, charset in args.font:
+        if source not in fonts:
+            sys.exit("error: %s no define la fuente %s" % (args.fonts, source))
+        width, height, table = fonts[source]
+        try:
+            code, report = subset(source, name, width, height, table, charset, args.bpp, args.reduce)
+        except ValueError as error:
+            sys.exit("error: %s" % error)
+        parts.append(code)
+        reports.append(report)
+
+    with open(args.output, "w", encoding="utf-8") as output:
+        output.write("\n".join(parts))
+    for report in reports:
+        print(report)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+"""Compresor de imagenes RGB565 para ILI9341DrawCompressedPicture.
+
+Convierte una imagen a una tabla C con el formato descripto en main/rle565.h. Acepta imagenes PPM binarias (P6), que
+se pueden exportar desde cualquier editor, o pixeles RGB565 crudos con el byte alto primero, que es el formato que usa
+ILI9341DrawPicture. Antes de escribir la tabla la decodifica y la compara con la original.
+
+Uso:
+    tools/rle565.py logo.ppm -o main/logo.c -n logo
+    tools/rle565.py fondo.bin --width 480 -o main/fondo.c -n fondo
+"""
+
+import argparse
+import sys
+
+TABLE_SIZE = 64
+LONG_RUN = 65
+MAX_LONG_RUN = LONG_RUN + 0x1FFF
+MAX_LITERALS = 32
+
+
+def color_hash(color):
+    return ((color >> 11) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) & (TABLE_SIZE - 1)
+
+
+def load_ppm(data):
+    fields = []
+    position = 0
+    while len(fields) < 4:
+        while data[position : position + 1].isspace():
+            position += 1
+        if data[position : position + 1] == b"#":
+            position = data.index(b"\n", position)
+            continue
+        end = position
+        while not data[end : end + 1].isspace():
+            end += 1
+        fields.append(data[position:end])
+        position = end
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("solo se aceptan imagenes PPM binarias de 8 bits por canal")
+    width, height = int(fields[1]), int(fields[2])
+    rgb = data[position + 1 : position + 1 + width * height * 3]
+    pixels = [((rgb[i] >> 3) << 11) | ((rgb[i + 1] >> 2) << 5) | (rgb[i + 2] >> 3) for i in range(0, len(rgb), 3)]
+    return width, height, pixels
+
+
+def load_raw(data, width):
+    if len(data) % (2 * width):
+        raise ValueError("el tamaño del archivo no es múltiplo de una fila de la imagen")
+    pixels = [(data[i] << 8) | data[i + 1] for i in range(0, len(data), 2)]
+    return width, len(pixels) // width, pixels
+
+
+def diff_code(previous, color):
+    fields = []
+    for shift, mask in ((11, 0x1F), (5, 0x3F), (0, 0x1F)):
+        delta = (((color >> shift) & mask) - ((previous >> shift) & mask)) % (mask + 1)
+        if delta > (mask + 1) // 2:
+            delta -= mask + 1
+        if not -2 <= delta <= 1:
+            return None
+        fields.append(delta + 2)
+    return 0x80 | (fields[0] << 4) | (fields[1] << 2) | fields[2]
+
+
+def encode(width, height, pixels):
+    out = bytearray(b"R5" + bytes((width >> 8, width & 0xFF, height >> 8, height & 0xFF)))
+    table = [0] * TABLE_SIZE
+    previous = 0
+    literals = []
+    index = 0
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_LITERALS]
+            del literals[:MAX_LITERALS]
+            out.append(0xC0 | (len(chunk) - 1))
+            for color in chunk:
+                out.extend((color >> 8, color & 0xFF))
+
+    while index < len(pixels):
+        color = pixels[index]
+        if color == previous:
+            run = 1
+            while index + run < len(pixels) and pixels[index + run] == previous and run < MAX_LONG_RUN:
+                run += 1
+            flush_literals()
+            if run >= LONG_RUN:
+                extra = run - LONG_RUN
+                out.extend((0xE0 | (extra >> 8), extra & 0xFF))
+            else:
+                out.append(run - 1)
+            index += run
+            continue
+
+        slot = color_hash(color)
+        code = None
+        if table[slot] == color:
+            code = 0x40 | slot
+        else:
+            code = diff_code(previous, color)
+        if code is not None:
+            flush_literals()
+            out.append(code)
+        else:
+            literals.append(color)
+        table[slot] = color
+        previous = color
+        index += 1
+
+    flush_literals()
+    return bytes(out)
+
+
+def decode(data):
+    width = (data[2] << 8) | data[3]
+    height = (data[4] << 8) | data[5]
+    table = [0] * TABLE_SIZE
+    previous = 0
+    pixels = []
+    position = 6
+
+    def remember(color):
+        table[color_hash(color)] = color
+        return color
+
+    while len(pixels) < width * height:
+        code = data[position]
+        position += 1
+        if code & 0xC0 == 0x00:
+            pixels.extend([previous] * ((code & 0x3F) + 1))
+        elif code & 0xC0 == 0x40:
+            previous = remember(table[code & 0x3F])
+            pixels.append(previous)
+        elif code & 0xC0 == 0x80:
+            red = ((previous >> 11) + ((code >> 4) & 3) - 2) & 0x1F
+            green = (((previous >> 5) & 0x3F) + ((code >> 2) & 3) - 2) & 0x3F
+            blue = ((previous & 0x1F) + (code & 3) - 2) & 0x1F
+            previous = remember((red << 11) | (green << 5) | blue)
+            pixels.append(previous)
+        elif code & 0xE0 == 0xE0:
+            pixels.extend([previous] * (LONG_RUN + ((code & 0x1F) << 8) + data[position]))
+            position += 1
+        else:
+            for _ in range((code & 0x1F) + 1):
+                previous = remember((data[position] << 8) | data[position + 1])
+                pixels.append(previous)
+                position += 2
+    return width, height, pixels
+
+
+def c_table(name, data, source):
+    lines = [
+        "/* Generado con tools/rle565.py a partir de %s, no editar */" % source,
+        "",
+        "#include <stdint.h>",
+        "",
+        "const uint8_t %s[%d] = {" % (name, len(data)),
+    ]
+    for start in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % value for value in data[start : start + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image", help="imagen PPM (P6) o RGB565 cruda con el byte alto primero")
+    parser.add_argument("--width", type=int, help="ancho en pixeles de una imagen cruda")
+    parser.add_argument("-o", "--output", required=True, help="archivo C a generar")
+    parser.add_argument("-n", "--name", required=True, help="nombre de la tabla en el archivo C")
+    args = parser.parse_args()
+
+    with open(args.image, "rb") as source:
+        data = source.read()
+    if data.startswith(b"P6"):
+        width, height, pixels = load_ppm(data)
+    elif args.width:
+        width, height, pixels = load_raw(data, args.width)
+    else:
+        parser.error("las imagenes crudas necesitan --width")
+
+    compressed = encode(width, height, pixels)
+    if decode(compressed) != (width, height, pixels):
+        sys.exit("error: la imagen decodificada no coincide con la original")
+
+    with open(args.output, "w") as output:
+        output.write(c_table(args.name, compressed, args.image))
+    print(
+        "%s: %dx%d, %d bytes sin comprimir, %d bytes comprimida (%.1f veces menos)"
+        % (args.name, width, height, 2 * len(pixels), len(compressed), 2.0 * len(pixels) / len(compressed))
+    )
+
+
+if __name__ == "__main__":
+    main()